@@ -0,0 +1,174 @@
+#pragma once
+
+/*
+ * Std Includes
+ */
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <vector>
+
+/*
+========================================================================================================
+	Defines
+========================================================================================================
+*/
+
+#define ARENA_BLOCK_SIZE (64 * 1024)
+
+/*
+========================================================================================================
+	Types Definitions
+========================================================================================================
+*/
+
+/*
+ * Monotonic allocator carving small objects out of large blocks, all released together with the
+ * arena. Freed chunks are kept by size and reused, so a long lived arena doesn't keep growing.
+ * Not thread safe, an arena is only used by the thread building its owner.
+ */
+class Arena {
+
+	/*
+	====================================================================================================
+		Instance Data Members
+	====================================================================================================
+	*/
+	private:
+
+		std::vector<char*> m_blocks;
+
+		char* m_current;
+
+		size_t m_available;
+
+		std::map<size_t, void*> m_free;
+
+		size_t m_allocations;
+
+		size_t m_used;
+
+	/*
+	====================================================================================================
+		Constructors / Destructor
+	====================================================================================================
+	*/
+	public:
+
+		Arena();
+
+		Arena(const Arena&) = delete;
+
+		~Arena();
+
+	/*
+	====================================================================================================
+		Instance Methods
+	====================================================================================================
+	*/
+	public:
+
+		void*
+		allocate(size_t size);
+
+		void
+		deallocate(void* pointer, size_t size);
+
+		size_t
+		allocations() const;
+
+		size_t
+		used() const;
+
+		size_t
+		blocks() const;
+
+	/*
+	====================================================================================================
+		Operators
+	====================================================================================================
+	*/
+	private:
+
+		Arena&
+		operator=(const Arena&) = delete;
+
+};
+
+/*
+ * Standard allocator over a shared arena. Every object it allocates keeps the arena alive, objects
+ * outliving the owner of the arena stay valid.
+ */
+template<typename T>
+class ArenaAllocator {
+
+	template<typename U>
+	friend class ArenaAllocator;
+
+	/*
+	====================================================================================================
+		Types Definitions
+	====================================================================================================
+	*/
+	public:
+
+		typedef T value_type;
+
+	/*
+	====================================================================================================
+		Instance Data Members
+	====================================================================================================
+	*/
+	private:
+
+		std::shared_ptr<Arena> m_arena;
+
+	/*
+	====================================================================================================
+		Constructors / Destructor
+	====================================================================================================
+	*/
+	public:
+
+		ArenaAllocator(const std::shared_ptr<Arena>& arena);
+
+		template<typename U>
+		ArenaAllocator(const ArenaAllocator<U>& allocator);
+
+	/*
+	====================================================================================================
+		Instance Methods
+	====================================================================================================
+	*/
+	public:
+
+		T*
+		allocate(size_t count);
+
+		void
+		deallocate(T* pointer, size_t count);
+
+	/*
+	====================================================================================================
+		Operators
+	====================================================================================================
+	*/
+	public:
+
+		template<typename U>
+		bool
+		operator==(const ArenaAllocator<U>& allocator) const;
+
+		template<typename U>
+		bool
+		operator!=(const ArenaAllocator<U>& allocator) const;
+
+};
+
+/*
+========================================================================================================
+	Template Definitions
+========================================================================================================
+*/
+
+#include "template/common/Arena.tpp"
\ No newline at end of file
@@ -0,0 +1,249 @@
+#pragma once
+
+/*
+ * Std Includes
+ */
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+/*
+========================================================================================================
+	Defines
+========================================================================================================
+*/
+
+#define BUFFER_MIN_CAPACITY 4096
+
+/*
+========================================================================================================
+	Types Definitions
+========================================================================================================
+*/
+
+typedef char byte;
+
+/*
+ * Owning, move only block of bytes. Growing keeps the written bytes, nothing is zeroed.
+ */
+class Buffer {
+
+	/*
+	====================================================================================================
+		Instance Data Members
+	====================================================================================================
+	*/
+	private:
+
+		std::unique_ptr<byte[]> m_data;
+
+		size_t m_size;
+
+		size_t m_capacity;
+
+	/*
+	====================================================================================================
+		Constructors / Destructor
+	====================================================================================================
+	*/
+	public:
+
+		Buffer();
+
+		explicit Buffer(size_t size);
+
+		Buffer(const Buffer&) = delete;
+
+		Buffer(Buffer&& buffer) noexcept;
+
+		~Buffer();
+
+	/*
+	====================================================================================================
+		Instance Methods
+	====================================================================================================
+	*/
+	public:
+
+		byte*
+		data();
+
+		const byte*
+		data() const;
+
+		size_t
+		size() const;
+
+		size_t
+		capacity() const;
+
+		void
+		reserve(size_t capacity);
+
+		void
+		resize(size_t size);
+
+		void
+		clear();
+
+	/*
+	====================================================================================================
+		Operators
+	====================================================================================================
+	*/
+	public:
+
+		Buffer&
+		operator=(const Buffer&) = delete;
+
+		Buffer&
+		operator=(Buffer&& buffer) noexcept;
+
+};
+
+/*
+ * Appends little endian values at the end of a buffer it doesn't own. Sizes only known once their
+ * content is written are reserved, then patched in place.
+ */
+class BufferWriter {
+
+	/*
+	====================================================================================================
+		Instance Data Members
+	====================================================================================================
+	*/
+	private:
+
+		Buffer& m_buffer;
+
+	/*
+	====================================================================================================
+		Constructors / Destructor
+	====================================================================================================
+	*/
+	public:
+
+		BufferWriter(Buffer& buffer);
+
+		~BufferWriter();
+
+	/*
+	====================================================================================================
+		Instance Methods
+	====================================================================================================
+	*/
+	public:
+
+		template<typename T>
+		BufferWriter&
+		write(T value);
+
+		BufferWriter&
+		write(const byte* data, size_t size);
+
+		BufferWriter&
+		write(const std::string& string);
+
+		template<typename T>
+		size_t
+		reserve();
+
+		template<typename T>
+		void
+		patch(size_t offset, T value);
+
+		size_t
+		beginBlock();
+
+		void
+		endBlock(size_t offset);
+
+		size_t
+		position() const;
+
+	private:
+
+		byte*
+		grow(size_t size);
+
+};
+
+/*
+ * Reads little endian values from bytes it doesn't own. Every read is bounds checked, the first
+ * one running out of bytes fails the reader and all the following ones.
+ */
+class BufferReader {
+
+	/*
+	====================================================================================================
+		Instance Data Members
+	====================================================================================================
+	*/
+	private:
+
+		const byte* m_data;
+
+		size_t m_size;
+
+		size_t m_position;
+
+		bool m_failed;
+
+	/*
+	====================================================================================================
+		Constructors / Destructor
+	====================================================================================================
+	*/
+	public:
+
+		BufferReader(const byte* data, size_t size);
+
+		BufferReader(const Buffer& buffer);
+
+		~BufferReader();
+
+	/*
+	====================================================================================================
+		Instance Methods
+	====================================================================================================
+	*/
+	public:
+
+		template<typename T>
+		bool
+		read(T& value);
+
+		bool
+		read(byte* data, size_t size);
+
+		bool
+		read(std::string& string);
+
+		bool
+		read(std::string& string, size_t size);
+
+		size_t
+		position() const;
+
+		size_t
+		remaining() const;
+
+		bool
+		failed() const;
+
+	private:
+
+		const byte*
+		take(size_t size);
+
+};
+
+/*
+========================================================================================================
+	Template Definitions
+========================================================================================================
+*/
+
+#include "template/common/Buffer.tpp"
\ No newline at end of file
@@ -3,10 +3,12 @@
 /*
  * Std Includes
  */
-#include <map>
-#include <vector>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
 #include <memory>
-#include <algorithm>
+#include <mutex>
 
 /*
 ========================================================================================================
@@ -14,9 +16,13 @@
 ========================================================================================================
 */
 
-typedef char byte;
-
-class Memory {
+/*
+ * Multi-producer single-consumer queue over a ring allocated once with the queue, guarded by a
+ * mutex. A full ring pushes back on its producers: they wait for the consumer to make room, and
+ * only spill into a heap overflow past their timeout. Only one thread at a time may pop.
+ */
+template<typename T>
+class MPSCQueue {
 
 	/*
 	====================================================================================================
@@ -25,13 +31,23 @@ class Memory {
 	*/
 	private:
 
-		size_t m_internalSize;
+		std::unique_ptr<T[]> m_slots;
+
+		size_t m_capacity;
+
+		size_t m_head;
+
+		size_t m_size;
+
+		std::deque<T> m_overflow;
 
-		byte* m_internalMemory;
+		size_t m_spilled;
 
-		byte* m_internalPointer;
+		size_t m_waiting;
 
-		bool m_allocate;
+		mutable std::mutex m_lock;
+
+		std::condition_variable m_space;
 
 	/*
 	====================================================================================================
@@ -40,15 +56,11 @@ class Memory {
 	*/
 	public:
 
-		Memory();
-
-		Memory(const Memory& memory);
+		explicit MPSCQueue(size_t capacity);
 
-		Memory(size_t size);
+		MPSCQueue(const MPSCQueue<T>&) = delete;
 
-		Memory(byte* external_memory, size_t external_size);
-
-		~Memory();
+		~MPSCQueue();
 
 	/*
 	====================================================================================================
@@ -57,45 +69,48 @@ class Memory {
 	*/
 	public:
 
-		byte*
-		lock(byte* memory, size_t size);
-
-		byte*
-		unlock();
-
-		Memory&
-		alloc(size_t size);
+		bool
+		tryPush(T& value);
 
 		void
-		free();
+		push(T&& value, std::chrono::milliseconds timeout);
 
-		void
-		reset();
+		bool
+		pop(T& value);
+
+		bool
+		empty() const;
 
 		size_t
-		write(byte* src, size_t size);
+		size() const;
 
 		size_t
-		read(byte* dst, size_t size);
+		capacity() const;
 
-		byte*
-		seek(size_t size);
+		size_t
+		spilled() const;
 
-		byte*
-		tell() const;
+	private:
 
-		size_t
-		size() const;
+		void
+		store(T& value);
 
 	/*
 	====================================================================================================
 		Operators
 	====================================================================================================
 	*/
-	public:
+	private:
+
+		MPSCQueue<T>&
+		operator=(const MPSCQueue<T>&) = delete;
 
-		operator byte*() const;
+};
 
-		Memory& operator=(const Memory&);
+/*
+========================================================================================================
+	Template Definitions
+========================================================================================================
+*/
 
-};
\ No newline at end of file
+#include "template/common/MPSCQueue.tpp"
\ No newline at end of file
@@ -0,0 +1,188 @@
+#pragma once
+
+/*
+ * Std Includes
+ */
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/*
+========================================================================================================
+	Defines
+========================================================================================================
+*/
+
+#define NAME_TABLE_MIN_PURGE 64
+
+/*
+========================================================================================================
+	Types Predeclarations
+========================================================================================================
+*/
+
+class NameTable;
+
+/*
+========================================================================================================
+	Types Definitions
+========================================================================================================
+*/
+
+typedef struct NameEntry {
+	uint32_t id;
+	std::string value;
+	// JSON string content, without the quotes
+	std::string escaped;
+	// Null once the entry isn't indexed anymore
+	NameTable* table;
+} NameEntry;
+
+/*
+ * Shared reference to a name. Every holder of an interned name sees its renames, and the escaped
+ * form is only computed when the name changes.
+ */
+class Name {
+
+	friend class NameTable;
+
+	/*
+	====================================================================================================
+		Instance Data Members
+	====================================================================================================
+	*/
+	private:
+
+		std::shared_ptr<NameEntry> m_entry;
+
+	/*
+	====================================================================================================
+		Constructors / Destructor
+	====================================================================================================
+	*/
+	public:
+
+		// Standalone name, not shared with any table
+		Name(const std::string& value);
+
+		Name(const char* value);
+
+	private:
+
+		Name(const std::shared_ptr<NameEntry>& entry);
+
+	/*
+	====================================================================================================
+		Instance Methods
+	====================================================================================================
+	*/
+	public:
+
+		uint32_t
+		id() const;
+
+		const std::string&
+		str() const;
+
+		const std::string&
+		escaped() const;
+
+		void
+		rename(const std::string& value);
+
+	/*
+	====================================================================================================
+		Operators
+	====================================================================================================
+	*/
+	public:
+
+		bool
+		operator==(const Name& name) const;
+
+		bool
+		operator!=(const Name& name) const;
+
+};
+
+/*
+ * Interning table of the names of a collection, each distinct name is stored once with a stable
+ * identifier. Entries nobody references anymore are purged as the table grows.
+ * Not thread safe, a table is only used by the thread building its owner.
+ */
+class NameTable {
+
+	friend class Name;
+
+	/*
+	====================================================================================================
+		Static Class Functions
+	====================================================================================================
+	*/
+	private:
+
+		static void
+		Escape(NameEntry* entry);
+
+	/*
+	====================================================================================================
+		Instance Data Members
+	====================================================================================================
+	*/
+	private:
+
+		// Keys view the value of their entry
+		std::unordered_map<std::string_view, std::shared_ptr<NameEntry>> m_entries;
+
+		uint32_t m_lastId;
+
+		size_t m_purgeThreshold;
+
+	/*
+	====================================================================================================
+		Constructors / Destructor
+	====================================================================================================
+	*/
+	public:
+
+		NameTable();
+
+		NameTable(const NameTable&) = delete;
+
+		~NameTable();
+
+	/*
+	====================================================================================================
+		Instance Methods
+	====================================================================================================
+	*/
+	public:
+
+		Name
+		intern(std::string_view value);
+
+		size_t
+		size() const;
+
+		size_t
+		purge();
+
+	private:
+
+		void
+		rename(NameEntry* entry, const std::string& value);
+
+	/*
+	====================================================================================================
+		Operators
+	====================================================================================================
+	*/
+	private:
+
+		NameTable&
+		operator=(const NameTable&) = delete;
+
+};
\ No newline at end of file
@@ -0,0 +1,148 @@
+#pragma once
+
+/*
+ * Std Includes
+ */
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*
+========================================================================================================
+	Defines
+========================================================================================================
+*/
+
+#define SLOT_MAP_MAX_SIZE 0xFFFF
+
+/*
+========================================================================================================
+	Types Definitions
+========================================================================================================
+*/
+
+/*
+ * 32 bits reference to an object of a SlotMap, slot index in the high half and generation of the
+ * slot in the low half. Generations start at 1, a zero handle never designates anything.
+ */
+template<typename T>
+struct Handle {
+
+	uint32_t value;
+
+	Handle() :
+		value(0) {
+	}
+
+	Handle(uint16_t index, uint16_t generation) :
+		value((static_cast<uint32_t>(index) << 16) | generation) {
+	}
+
+	uint16_t
+	index() const {
+		return static_cast<uint16_t>(value >> 16);
+	}
+
+	uint16_t
+	generation() const {
+		return static_cast<uint16_t>(value & 0xFFFF);
+	}
+
+	bool
+	empty() const {
+		return value == 0;
+	}
+
+	bool
+	operator==(const Handle<T>& handle) const {
+		return value == handle.value;
+	}
+
+	bool
+	operator!=(const Handle<T>& handle) const {
+		return value != handle.value;
+	}
+
+};
+
+/*
+ * Generational arena of non-owned objects. Freeing a slot bumps its generation, so every handle
+ * still designating it is detected as stale in O(1), without tracking who holds it.
+ */
+template<typename T>
+class SlotMap {
+
+	/*
+	====================================================================================================
+		Instance Data Members
+	====================================================================================================
+	*/
+	private:
+
+		std::vector<T*> m_objects;
+
+		std::vector<uint16_t> m_generations;
+
+		std::vector<uint16_t> m_free;
+
+		size_t m_size;
+
+	/*
+	====================================================================================================
+		Constructors / Destructor
+	====================================================================================================
+	*/
+	public:
+
+		SlotMap();
+
+		SlotMap(const SlotMap<T>&) = delete;
+
+		~SlotMap();
+
+	/*
+	====================================================================================================
+		Instance Methods
+	====================================================================================================
+	*/
+	public:
+
+		Handle<T>
+		insert(T* object);
+
+		bool
+		erase(Handle<T> handle);
+
+		T*
+		get(Handle<T> handle) const;
+
+		size_t
+		size() const;
+
+		void
+		clear();
+
+	private:
+
+		void
+		release(uint16_t index);
+
+	/*
+	====================================================================================================
+		Operators
+	====================================================================================================
+	*/
+	private:
+
+		SlotMap<T>&
+		operator=(const SlotMap<T>&) = delete;
+
+};
+
+/*
+========================================================================================================
+	Template Definitions
+========================================================================================================
+*/
+
+#include "template/common/SlotMap.tpp"
\ No newline at end of file
@@ -0,0 +1,114 @@
+#pragma once
+
+/*
+ * Std Includes
+ */
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+========================================================================================================
+	Defines
+========================================================================================================
+*/
+
+#define WORKER_POOL_MAX_SIZE 16
+
+/*
+========================================================================================================
+	Types Definitions
+========================================================================================================
+*/
+
+/*
+ * Bounded pool of persistent threads running independent tasks of a batch. The calling thread
+ * takes part in the batch and run() only returns once every task is done.
+ */
+class WorkerPool {
+
+	/*
+	====================================================================================================
+		Instance Data Members
+	====================================================================================================
+	*/
+	private:
+
+		size_t m_workers;
+
+		std::vector<std::thread> m_threads;
+
+		// Held for a whole batch, batches submitted from several threads run one after the other
+		std::mutex m_runLock;
+
+		std::mutex m_lock;
+
+		std::condition_variable m_wake;
+
+		std::condition_variable m_done;
+
+		const std::function<void(size_t)>* m_task;
+
+		size_t m_count;
+
+		std::atomic<size_t> m_next;
+
+		uint64_t m_batch;
+
+		size_t m_active;
+
+		bool m_stopping;
+
+		std::exception_ptr m_error;
+
+	/*
+	====================================================================================================
+		Constructors / Destructor
+	====================================================================================================
+	*/
+	public:
+
+		WorkerPool(size_t workers = 0);
+
+		WorkerPool(const WorkerPool&) = delete;
+
+		~WorkerPool();
+
+	/*
+	====================================================================================================
+		Instance Methods
+	====================================================================================================
+	*/
+	public:
+
+		size_t
+		workers() const;
+
+		void
+		run(size_t count, const std::function<void(size_t)>& task);
+
+	private:
+
+		void
+		work();
+
+		void
+		drain(const std::function<void(size_t)>& task, size_t count);
+
+	/*
+	====================================================================================================
+		Operators
+	====================================================================================================
+	*/
+	private:
+
+		WorkerPool&
+		operator=(const WorkerPool&) = delete;
+
+};
\ No newline at end of file
@@ -3,25 +3,13 @@
 /*
  * STL Includes
  */
-#include <iostream>
-
-/*
- * Qt Includes
- */
-#include <QMap>
-#include <QSet>
-#include <QVector>
-
-/*
- * OBS Includes
- */
-#include <obs.h>
-#include <obs-frontend-api/obs-frontend-api.h>
+#include <vector>
 
 /*
  * Plugin Includes
  */
-#include "include/events/EventObserver.hpp"
+#include "include/events/EventSlot.hpp"
+#include "include/events/EventTable.hpp"
 
 /*
 ========================================================================================================
@@ -30,47 +18,7 @@
 */
 
 template<typename T>
-class EventObservable<T> {
-
-	/*
-	====================================================================================================
-		Constructors / Destructor
-	====================================================================================================
-	*/
-	protected:
-
-		EventObservable();
-	
-		virtual ~EventObservable() = 0;
-
-	/*
-	====================================================================================================
-		Abstract Pure Virtual Instance Methods
-	====================================================================================================
-	*/
-	public:
-
-		virtual void
-		addEventHandler(const T& event, const EventObserver<T>* event_handler) = 0;         
-		
-		virtual void
-		remEventHandler(const T& event, const EventObserver<T>* event_handler) = 0;
-
-	protected:
-
-		virtual void
-		addEvent(const T& event) = 0;
-
-		virtual void
-		removeEvent(const T& event) = 0;
-
-		virtual bool
-		notifyEvent(const T& event) const = 0;
-
-};
-
-template<typename T>
-class SafeEventObservable : protected EventObservable<T> {
+class EventObservable {
 
 	/*
 	====================================================================================================
@@ -79,7 +27,7 @@ class SafeEventObservable : protected EventObservable<T> {
 	*/
 	protected:
 
-		QMap<T, QSet<EventObserver<T>*>> m_eventHandlers;
+		EventTable<T, EventSlot<T>> m_eventHandlers;
 	
 	/*
 	====================================================================================================
@@ -88,9 +36,9 @@ class SafeEventObservable : protected EventObservable<T> {
 	*/
 	public:
 
-		SafeEventObservable();
+		EventObservable();
 
-		virtual ~SafeEventObservable();
+		virtual ~EventObservable();
 	
 	/*
 	====================================================================================================
@@ -99,71 +47,20 @@ class SafeEventObservable : protected EventObservable<T> {
 	*/
 	public:
 
-		virtual void
-		addEventHandler(const T& event, const EventObserver<T>* event_handler) override;
-
-		virtual void
-		remEventHandler(const T& event, const EventObserver<T>* event_handler) override;
+		void
+		addEventHandler(const T& event, const EventSlot<T>& event_handler);
 
-		virtual void
-		addEvent(const T& event) override;
+		void
+		remEventHandler(const T& event, const EventSlot<T>& event_handler);
 
-		virtual void
-		removeEvent(const T& event) override;
+		void
+		addEvent(const T& event);
 
-		virtual bool
-		notifyEvent(const T& event) const override;
+		void
+		removeEvent(const T& event);
 
-		template<typename B> 
 		bool
-		notifyEvent(const T& event, const B& data) const;
-
-};
-
-template<typename T>
-class UnsafeEventObservable : public EventObservable<T> {
-
-	/*
-	====================================================================================================
-		Instance Data Members
-	====================================================================================================
-	*/
-	protected:
-
-		QMap<T, QSet<typename EventObserver<T>::FuncWrapper*>> m_eventHandlers;
-	
-	/*
-	====================================================================================================
-		Constructors / Destructor
-	====================================================================================================
-	*/
-	public:
-
-		UnsafeEventObservable();
-
-		virtual ~UnsafeEventObservable();
-	
-	/*
-	====================================================================================================
-		Instance Methods
-	====================================================================================================
-	*/
-	public:
-
-		virtual void
-		addEventHandler(const T& event, const EventObserver<T>* event_handler) override;
-
-		virtual void
-		remEventHandler(const T& event, const EventObserver<T>* event_handler) override;
-
-		virtual void
-		addEvent(const T& event) override;
-
-		virtual void
-		removeEvent(const T& event) override;
-
-		virtual bool
-		notifyEvent(const T& event) const override;
+		notifyEvent(const T& event) const;
 
 		template<typename B>
 		bool
@@ -177,6 +74,4 @@ class UnsafeEventObservable : public EventObservable<T> {
 ========================================================================================================
 */
 
-#include "template/events/EventObservable.tpp"
-#include "template/events/UnsafeEventObservable.tpp"
-#include "template/events/SafeEventObservable.tpp"
\ No newline at end of file
+#include "template/events/EventObservable.tpp"
\ No newline at end of file
@@ -0,0 +1,133 @@
+#pragma once
+
+/*
+ * STL Includes
+ */
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+/*
+ * Plugin Includes
+ */
+#include "include/events/EventTraits.hpp"
+
+/*
+========================================================================================================
+	Defines
+========================================================================================================
+*/
+
+// Large enough for member function pointers of classes with multiple or virtual bases
+#define EVENT_SLOT_STORAGE_SIZE (4 * sizeof(void*))
+
+/*
+========================================================================================================
+	Types Predeclarations
+========================================================================================================
+*/
+
+template<typename B>
+struct event_signature {
+	typedef bool type(B);
+};
+
+template<>
+struct event_signature<void> {
+	typedef bool type();
+};
+
+template<typename E, typename S = typename event_signature<typename event_traits<E>::payload>::type>
+class EventSlot;
+
+/*
+========================================================================================================
+	Types Definitions
+========================================================================================================
+*/
+
+/*
+ * A member function bound to its instance, called through a thunk instantiated for the exact
+ * handler class. The handler signature is fixed by the payload of E, a handler or a notification
+ * with another payload type doesn't compile.
+ */
+template<typename E, typename... A>
+class EventSlot<E, bool(A...)> {
+
+	/*
+	====================================================================================================
+		Types Definitions
+	====================================================================================================
+	*/
+	private:
+
+		typedef bool (*Thunk)(const EventSlot<E, bool(A...)>& slot, A... args);
+
+	/*
+	====================================================================================================
+		Static Class Functions
+	====================================================================================================
+	*/
+	private:
+
+		template<typename T>
+		static bool
+		invoke(const EventSlot<E, bool(A...)>& slot, A... args);
+
+	/*
+	====================================================================================================
+		Instance Data Members
+	====================================================================================================
+	*/
+	private:
+
+		void* m_instance;
+
+		Thunk m_thunk;
+
+		typename std::aligned_storage<EVENT_SLOT_STORAGE_SIZE>::type m_callback;
+
+	/*
+	====================================================================================================
+		Constructors / Destructor
+	====================================================================================================
+	*/
+	public:
+
+		EventSlot();
+
+		template<typename T>
+		EventSlot(T* instance, bool (T::*callback)(A...));
+
+	/*
+	====================================================================================================
+		Operators
+	====================================================================================================
+	*/
+	public:
+
+		bool
+		operator()(A... args) const;
+
+		bool
+		operator==(const EventSlot<E, bool(A...)>& slot) const;
+
+	/*
+	====================================================================================================
+		Instance Methods
+	====================================================================================================
+	*/
+	public:
+
+		bool
+		empty() const;
+
+};
+
+/*
+========================================================================================================
+	Template Definitions
+========================================================================================================
+*/
+
+#include "template/events/EventSlot.tpp"
\ No newline at end of file
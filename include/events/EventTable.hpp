@@ -0,0 +1,161 @@
+#pragma once
+
+/*
+ * STL Includes
+ */
+#include <array>
+#include <bitset>
+#include <vector>
+
+/*
+ * Qt Includes
+ */
+#include <QMap>
+
+/*
+ * Plugin Includes
+ */
+#include "include/events/EventTraits.hpp"
+
+/*
+========================================================================================================
+	Types Predeclarations
+========================================================================================================
+*/
+
+template<typename T, typename H, bool = event_traits<T>::bounded>
+class EventTable;
+
+/*
+========================================================================================================
+	Types Definitions
+========================================================================================================
+*/
+
+/*
+ * Handlers of unbounded events, looked up through a map.
+ */
+template<typename T, typename H>
+class EventTable<T, H, false> {
+
+	/*
+	====================================================================================================
+		Instance Data Members
+	====================================================================================================
+	*/
+	private:
+
+		QMap<T, std::vector<H>> m_handlers;
+
+	/*
+	====================================================================================================
+		Constructors / Destructor
+	====================================================================================================
+	*/
+	public:
+
+		EventTable();
+
+		~EventTable();
+
+	/*
+	====================================================================================================
+		Instance Methods
+	====================================================================================================
+	*/
+	public:
+
+		bool
+		contains(const T& event) const;
+
+		void
+		add(const T& event);
+
+		void
+		remove(const T& event);
+
+		void
+		insert(const T& event, const H& handler);
+
+		void
+		erase(const T& event, const H& handler);
+
+		const std::vector<H>*
+		handlers(const T& event) const;
+
+		void
+		clear();
+
+};
+
+/*
+ * Handlers of bounded events, stored in a fixed size table indexed by the enum value.
+ * Values out of [0, size) can't be registered.
+ */
+template<typename T, typename H>
+class EventTable<T, H, true> {
+
+	/*
+	====================================================================================================
+		Instance Data Members
+	====================================================================================================
+	*/
+	private:
+
+		std::array<std::vector<H>, event_traits<T>::size> m_handlers;
+
+		std::bitset<event_traits<T>::size> m_registered;
+
+	/*
+	====================================================================================================
+		Constructors / Destructor
+	====================================================================================================
+	*/
+	public:
+
+		EventTable();
+
+		~EventTable();
+
+	/*
+	====================================================================================================
+		Instance Methods
+	====================================================================================================
+	*/
+	public:
+
+		bool
+		contains(const T& event) const;
+
+		void
+		add(const T& event);
+
+		void
+		remove(const T& event);
+
+		void
+		insert(const T& event, const H& handler);
+
+		void
+		erase(const T& event, const H& handler);
+
+		const std::vector<H>*
+		handlers(const T& event) const;
+
+		void
+		clear();
+
+	private:
+
+		static size_t
+		index(const T& event);
+
+};
+
+/*
+========================================================================================================
+	Template Definitions
+========================================================================================================
+*/
+
+#include "template/events/EventTable.tpp"
\ No newline at end of file
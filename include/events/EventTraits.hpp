@@ -0,0 +1,24 @@
+#pragma once
+
+/*
+ * STL Includes
+ */
+#include <cstddef>
+
+/*
+========================================================================================================
+	Types Definitions
+========================================================================================================
+*/
+
+/*
+ * Describes the range of an event enum and the payload its handlers receive. Bounded enums declare
+ * their size so their handlers can be stored in a flat table indexed by the enum value, any other
+ * type is dispatched through a map.
+ */
+template<typename T>
+struct event_traits {
+	static constexpr bool bounded = false;
+	static constexpr size_t size = 0;
+	typedef void payload;
+};
\ No newline at end of file
@@ -9,7 +9,7 @@
  * Plugin Includes
  */
 #include "include/events/EventObservable.hpp"
-#include "include/events/EventObserver.hpp"
+#include "include/events/EventSlot.hpp"
 
 /*
 ========================================================================================================
@@ -18,7 +18,7 @@
 */
 
 template<typename EventType>
-using EventHandler = std::pair<EventType, EventObserver<EventType>*>;
+using EventHandler = std::pair<EventType, EventSlot<EventType>>;
 
 template<typename EventType>
 class EventTriggerTyped {
@@ -30,7 +30,7 @@ class EventTriggerTyped {
 	*/
 	protected:
 
-		UnsafeEventObservable<EventType> m_event;
+		EventObservable<EventType> m_event;
 
 	/*
 	====================================================================================================
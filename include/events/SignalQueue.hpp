@@ -0,0 +1,204 @@
+#pragma once
+
+/*
+ * Std Includes
+ */
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+/*
+ * Qt Includes
+ */
+#include <QEvent>
+#include <QObject>
+
+/*
+ * OBS Includes
+ */
+#include <obs.h>
+
+/*
+ * Plugin Includes
+ */
+#include "include/common/MPSCQueue.hpp"
+
+/*
+========================================================================================================
+	Defines
+========================================================================================================
+*/
+
+// Signals pending at once before producers wait for the model thread
+#define SIGNAL_QUEUE_CAPACITY 1024
+
+// How long a producer waits for room before spilling into the heap
+#define SIGNAL_QUEUE_BACKPRESSURE_MS 50
+
+// Wake events in flight at once, one is posted per burst
+#define SIGNAL_WAKE_EVENTS 4
+
+/*
+========================================================================================================
+	Types Definitions
+========================================================================================================
+*/
+
+typedef struct SignalRecord SignalRecord;
+
+// Runs on the model thread. Records are also dispatched without delivery on shutdown, so the
+// references they hold are released
+typedef void (*SignalDispatch)(SignalRecord& record, bool deliver);
+
+/*
+ * An OBS signal captured on the thread that emitted it. The meaning of the fields belongs to the
+ * trigger that posted it, strings are copied as calldata only lives during the callback.
+ */
+typedef struct SignalRecord {
+	SignalDispatch dispatch;
+	void* trigger;
+	int event;
+	void* object;
+	void* reference;
+	union {
+		bool boolean_value;
+		int64_t int_value;
+		const char* state;
+	} value;
+	std::string string;
+} SignalRecord;
+
+/*
+ * Posted to the model thread once per burst. Qt owns and deletes posted events, they are
+ * constructed in slots allocated with the queue and only fall back to the heap when all of them
+ * are in flight.
+ */
+class SignalWakeEvent : public QEvent {
+
+	/*
+	====================================================================================================
+		Static Class Attributes
+	====================================================================================================
+	*/
+	public:
+
+		static const QEvent::Type Type;
+
+	private:
+
+		static void* _slots[SIGNAL_WAKE_EVENTS];
+
+		static std::atomic<uint32_t> _used;
+
+	/*
+	====================================================================================================
+		Static Class Functions
+	====================================================================================================
+	*/
+	public:
+
+		static void
+		allocateSlots();
+
+		static void
+		releaseSlots();
+
+	/*
+	====================================================================================================
+		Constructors / Destructor
+	====================================================================================================
+	*/
+	public:
+
+		SignalWakeEvent();
+
+		~SignalWakeEvent();
+
+	/*
+	====================================================================================================
+		Operators
+	====================================================================================================
+	*/
+	public:
+
+		static void*
+		operator new(size_t size);
+
+		static void
+		operator delete(void* pointer);
+
+};
+
+/*
+ * Lives on the model thread and drains the queue when woken.
+ */
+class SignalReceiver : public QObject {
+
+	/*
+	====================================================================================================
+		Instance Methods
+	====================================================================================================
+	*/
+	public:
+
+		bool
+		event(QEvent* event) override;
+
+};
+
+/*
+ * Marshals the OBS signals onto the model thread. libobs emits them from any thread, they are
+ * pushed here and a single drain per burst dispatches them in order on the Qt main thread, the
+ * only consumer of the queue. initialize() and clear() are only called on that thread too.
+ *
+ * Posting a mute, flags or ADDED/REMOVED signal allocates nothing on the plugin side while fewer
+ * than SIGNAL_QUEUE_CAPACITY signals are pending: the record lands in the preallocated ring and
+ * the wake event in a preallocated slot. Rename signals still copy their name into the record.
+ */
+class SignalQueue {
+
+	/*
+	====================================================================================================
+		Static Class Attributes
+	====================================================================================================
+	*/
+	private:
+
+		static MPSCQueue<SignalRecord> _records;
+
+		static std::atomic<bool> _scheduled;
+
+		static SignalReceiver* _receiver;
+
+		static std::mutex _receiverLock;
+
+		static size_t _spilled;
+
+	/*
+	====================================================================================================
+		Static Class Functions
+	====================================================================================================
+	*/
+	public:
+
+		static void
+		initialize();
+
+		static void
+		post(SignalRecord&& record);
+
+		static void
+		drain();
+
+		static void
+		clear();
+
+		static bool
+		onModelThread();
+
+		static obs_source_t*
+		retain(obs_source_t* source);
+
+};
\ No newline at end of file
@@ -0,0 +1,105 @@
+#pragma once
+
+/*
+ * Std Includes
+ */
+#include <cstddef>
+
+/*
+ * OBS Includes
+ */
+#include <obs.h>
+
+/*
+========================================================================================================
+	Types Definitions
+========================================================================================================
+*/
+
+/*
+ * Fixed set of OBS signal handlers bound to their owner. Each entry is connected with its own
+ * address as signal data, a signal is one indirect member call: nothing is copied or allocated.
+ * Entries must not move once connected, the registry can't be copied.
+ */
+template<typename T, size_t N>
+class SignalRegistry {
+
+	/*
+	====================================================================================================
+		Types Definitions
+	====================================================================================================
+	*/
+	public:
+
+		typedef void (T::*Handler)(calldata_t* data);
+
+	private:
+
+		typedef struct Entry {
+			T* owner;
+			Handler handler;
+			const char* signal;
+		} Entry;
+
+	/*
+	====================================================================================================
+		Static Class Functions
+	====================================================================================================
+	*/
+	private:
+
+		static void
+		Call(void* entry, calldata_t* data);
+
+	/*
+	====================================================================================================
+		Instance Data Members
+	====================================================================================================
+	*/
+	private:
+
+		Entry m_entries[N];
+
+		size_t m_size;
+
+	/*
+	====================================================================================================
+		Constructors / Destructor
+	====================================================================================================
+	*/
+	public:
+
+		SignalRegistry();
+
+		SignalRegistry(const SignalRegistry<T, N>&) = delete;
+
+		~SignalRegistry();
+
+	/*
+	====================================================================================================
+		Instance Methods
+	====================================================================================================
+	*/
+	public:
+
+		bool
+		add(const char* signal, T* owner, Handler handler);
+
+		void
+		connect(signal_handler_t* signal_handler);
+
+		void
+		disconnect(signal_handler_t* signal_handler);
+
+		size_t
+		size() const;
+
+};
+
+/*
+========================================================================================================
+	Template Definitions
+========================================================================================================
+*/
+
+#include "template/events/SignalRegistry.tpp"
\ No newline at end of file
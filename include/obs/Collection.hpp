@@ -3,9 +3,12 @@
 /*
  * STL Includes
  */
+#include <atomic>
+#include <deque>
 #include <map>
 #include <vector>
 #include <memory>
+#include <string_view>
 
 /*
  * OBS Includes
@@ -17,12 +20,26 @@
 /*
  * Plugin Includes
  */
-#include "include/common/Memory.hpp"
+#include "include/common/Arena.hpp"
+#include "include/common/Buffer.hpp"
+#include "include/common/NameTable.hpp"
+#include "include/common/SlotMap.hpp"
 #include "include/obs/OBSStorage.hpp"
 #include "include/obs/OBSEvents.hpp"
 #include "include/obs/Scene.hpp"
+#include "include/obs/Snapshot.hpp"
 #include "include/obs/Source.hpp"
 
+/*
+========================================================================================================
+	Defines
+========================================================================================================
+*/
+
+#define COLLECTION_JOURNAL_SIZE 256
+
+#define COLLECTION_CHECK_INTERVAL 64
+
 /*
 ========================================================================================================
 	Types Predeclarations
@@ -41,25 +58,55 @@ typedef Collection* CollectionPtr;
 
 typedef std::vector<Collection*> Collections;
 
+typedef struct Change {
+	uint64_t revision;
+	bool scene;
+	bool registrable;
+	bool removed;
+	uint16_t id;
+	// Collection wide change, no scene or source is listed for it
+	bool collection = false;
+} Change;
+
+typedef struct Delta {
+	const Collection* collection;
+	uint64_t from;
+	uint64_t revision;
+	// Set when the journal can't cover the gap, the lists then hold the whole collection
+	bool snapshot;
+	std::vector<uint16_t> scenes;
+	// Registrable flag << 16 + source id, as in the wire identifiers
+	std::vector<uint32_t> sources;
+	std::vector<uint16_t> removedScenes;
+	// Registrable flag << 16 + source id, as in the wire identifiers
+	std::vector<uint32_t> removedSources;
+} Delta;
+
+typedef struct Revision {
+	uint16_t collection;
+	uint64_t revision;
+} Revision;
+
 class Collection : public OBSStorable {
 
 	/*
 	====================================================================================================
-		Constants
+		Static Class Functions
 	====================================================================================================
 	*/
 	public:
 
-		static const unsigned int MAX_NAME_LENGTH = 99;
+		static Collection* buildFromBuffer(BufferReader& reader);
 
 	/*
 	====================================================================================================
-		Static Class Functions
+		Static Class Attributes
 	====================================================================================================
 	*/
-	public:
+	private:
 
-		static Collection* buildFromMemory(Memory& memory);
+		// Collections may be built concurrently at startup
+		static std::atomic<uint64_t> _last_version;
 
 	/*
 	====================================================================================================
@@ -74,6 +121,19 @@ class Collection : public OBSStorable {
 
 	private:
 
+		// Model objects of the collection, with their shared pointer control blocks
+		std::shared_ptr<Arena> m_arena;
+
+		// Names shared by the sources, scenes and items of the collection
+		NameTable m_names;
+
+		// Declared first, the objects of the storages still detach themselves while destroyed
+		SlotMap<Source> m_sourceHandles;
+
+		SlotMap<Scene> m_sceneHandles;
+
+		SlotMap<Item> m_itemHandles;
+
 		OBSStorage<Scene> m_scenes;
 
 		OBSStorage<Source> m_sources;
@@ -84,6 +144,23 @@ class Collection : public OBSStorable {
 
 		uint16_t m_lastSourceID;
 
+		uint64_t m_version;
+
+		std::deque<Change> m_journal;
+
+		uint64_t m_journalFloor;
+
+		// Scenes changes applied from signals since the last full rescan
+		uint32_t m_uncheckedChanges;
+
+		size_t m_mismatches;
+
+		// Built from its collection file, OBS sources are bound on its first activation
+		bool m_deferred;
+
+		// Published on every change, copied first while a reader still holds it
+		std::shared_ptr<Snapshot> m_snapshot;
+
 	/*
 	====================================================================================================
 		Constructors / Destructor
@@ -133,7 +210,7 @@ class Collection : public OBSStorable {
 		getSourceById(uint16_t id) const;
 
 		Source*
-		getSourceByName(const std::string& name) const;
+		getSourceByName(std::string_view name) const;
 
 		void
 		loadSources();
@@ -141,12 +218,24 @@ class Collection : public OBSStorable {
 		void
 		loadScenes();
 
+		void
+		load(obs_data_t* data);
+
 		void
 		synchronize();
 
 		obs::scene::event
 		updateScenes(std::shared_ptr<Scene>& scene_updated);
 
+		bool
+		checkScenes();
+
+		size_t
+		verifyScenes();
+
+		size_t
+		mismatches() const;
+
 		bool
 		switchScene(uint16_t id);
 
@@ -160,7 +249,7 @@ class Collection : public OBSStorable {
 		getSceneById(uint16_t id) const;
 
 		Scene*
-		getSceneByName(const std::string& name) const;
+		getSceneByName(std::string_view name) const;
 
 		Scenes
 		scenes() const;
@@ -168,7 +257,105 @@ class Collection : public OBSStorable {
 		Sources
 		sources() const;
 
-		Memory
-		toMemory(size_t& size) const;
+		uint64_t
+		version() const;
+
+		uint64_t
+		touch();
+
+		uint64_t
+		touch(const Scene& scene, bool removed = false);
+
+		uint64_t
+		touch(const Source& source, bool removed = false);
+
+		Delta
+		delta(uint64_t revision) const;
+
+		SnapshotPtr
+		snapshot() const;
+
+		template<typename T, typename... A>
+		std::shared_ptr<T>
+		make(A&&... args);
+
+		const Arena&
+		arena() const;
+
+		Name
+		intern(std::string_view name);
+
+		const NameTable&
+		names() const;
+
+		Handle<Source>
+		attach(Source* source);
+
+		Handle<Scene>
+		attach(Scene* scene);
+
+		Handle<Item>
+		attach(Item* item);
+
+		void
+		detach(Handle<Source> handle);
+
+		void
+		detach(Handle<Scene> handle);
+
+		void
+		detach(Handle<Item> handle);
+
+		Source*
+		resolve(Handle<Source> handle) const;
+
+		Scene*
+		resolve(Handle<Scene> handle) const;
+
+		Item*
+		resolve(Handle<Item> handle) const;
+
+		void
+		toBuffer(BufferWriter& writer) const;
+
+	private:
+
+		uint64_t
+		record(const Change& change);
+
+		Snapshot&
+		writable();
+
+		void
+		publish(const Scene& scene, bool removed);
+
+		void
+		publish(const Source& source, bool removed);
+
+		std::shared_ptr<Source>
+		popSource(uint16_t id);
+
+		std::shared_ptr<Scene>
+		popScene(uint16_t id);
+
+		SceneNodePtr
+		node(const Scene& scene) const;
+
+		SourceNodePtr
+		node(const Source& source) const;
+
+		Scene*
+		diffScenes(const obs_frontend_source_list& obs_scenes, int64_t& unknown, size_t& differences) const;
+
+		void
+		reindex(const std::string& old_name, const Name& name);
+
+};
+
+/*
+========================================================================================================
+	Template Definitions
+========================================================================================================
+*/
 
-};
\ No newline at end of file
+#include "template/obs/Collection.tpp"
\ No newline at end of file
@@ -0,0 +1,99 @@
+#pragma once
+
+/*
+ * STL Includes
+ */
+#include <map>
+#include <string>
+
+/*
+ * OBS Includes
+ */
+#include <obs.h>
+#include <obs-module.h>
+
+/*
+ * Plugin Includes
+ */
+#include "include/common/WorkerPool.hpp"
+
+/*
+========================================================================================================
+	Defines
+========================================================================================================
+*/
+
+// Relative to the OBS configuration directory
+#define COLLECTIONS_DIRECTORY "obs-studio/basic/scenes"
+
+/*
+========================================================================================================
+	Types Definitions
+========================================================================================================
+*/
+
+/*
+ * Reads the scene collection files OBS saves, so the model of a collection can be built without
+ * OBS switching into it and creating all of its sources.
+ */
+class CollectionLoader {
+
+	/*
+	====================================================================================================
+		Static Class Functions
+	====================================================================================================
+	*/
+	public:
+
+		static std::string
+		directory();
+
+		static std::string
+		fileName(const std::string& name);
+
+	/*
+	====================================================================================================
+		Instance Data Members
+	====================================================================================================
+	*/
+	private:
+
+		std::map<std::string, obs_data_t*> m_collections;
+
+	/*
+	====================================================================================================
+		Constructors / Destructor
+	====================================================================================================
+	*/
+	public:
+
+		CollectionLoader(const std::string& directory, WorkerPool& pool, const std::string& skipped = "");
+
+		CollectionLoader(const CollectionLoader&) = delete;
+
+		~CollectionLoader();
+
+	/*
+	====================================================================================================
+		Instance Methods
+	====================================================================================================
+	*/
+	public:
+
+		obs_data_t*
+		data(const std::string& name) const;
+
+		size_t
+		size() const;
+
+	/*
+	====================================================================================================
+		Operators
+	====================================================================================================
+	*/
+	private:
+
+		CollectionLoader&
+		operator=(const CollectionLoader&) = delete;
+
+};
\ No newline at end of file
@@ -17,6 +17,7 @@
 /*
  * Plugin Includes
  */
+#include "include/common/SlotMap.hpp"
 #include "include/obs/OBSStorage.hpp"
 
 /*
@@ -50,10 +51,14 @@ typedef struct Items {
 
 class Item : public OBSStorable {
 
+	friend class Collection;
+
 	friend class ItemBuilder;
 
 	friend class ItemGroup;
 
+	friend class Scene;
+
 	/*
 	====================================================================================================
 		Instance Data Members
@@ -69,7 +74,9 @@ class Item : public OBSStorable {
 
 		obs_sceneitem_t* m_item;
 
-		Source* m_sourceRef;
+		Handle<Item> m_handle;
+
+		Handle<Source> m_sourceHandle;
 
 		bool m_visible;
 
@@ -96,6 +103,9 @@ class Item : public OBSStorable {
 		Scene*
 		scene() const;
 
+		Handle<Item>
+		handle() const;
+
 		const Source*
 		source() const;
 
@@ -35,7 +35,7 @@ class ItemBuilder {
 	*/
 	private:
 
-		std::map<std::string, Item*(ItemBuilder::*)(Scene*, uint16_t, obs_sceneitem_t*)> m_builders;
+		std::map<std::string, std::shared_ptr<Item>(ItemBuilder::*)(Scene*, uint16_t, obs_sceneitem_t*)> m_builders;
 
 	/*
 	====================================================================================================
@@ -63,13 +63,13 @@ class ItemBuilder {
 	*/
 	public:
 
-		Item*
+		std::shared_ptr<Item>
 		build(Scene* scene, obs_sceneitem_t* obs_item) {
 			uint16_t id = static_cast<uint16_t>(obs_sceneitem_get_id(obs_item));
 			obs_source_t* obs_source = obs_sceneitem_get_source(obs_item);
 			const char* name = obs_source_get_name(obs_source);
 
-			Item* item = nullptr;
+			std::shared_ptr<Item> item = nullptr;
 
 			auto builder = m_builders.find(obs_source_get_id(obs_source));
 			if(builder == m_builders.end())
@@ -82,27 +82,58 @@ class ItemBuilder {
 			return item;
 		}
 
+		std::shared_ptr<Item>
+		build(Scene* scene, obs_data_t* item_data) {
+			uint16_t id = static_cast<uint16_t>(obs_data_get_int(item_data, "id"));
+			std::string name = obs_data_get_string(item_data, "name");
+			Collection* collection = scene->collection();
+
+			std::shared_ptr<Item> item = nullptr;
+
+			// Items read from a scene collection file, the kind follows the referenced source
+			Scene* scene_ref = collection->getSceneByName(name);
+			if(scene_ref != nullptr) {
+				item = collection->make<ItemScene>(scene, id, name);
+				item->m_sourceHandle = scene_ref->sourcedScene().handle();
+			}
+			else {
+				Source* source = collection->getSourceByName(name);
+				if(source == nullptr)
+					return nullptr;
+
+				if(strcmp(source->type(), "group") == 0)
+					item = collection->make<ItemGroup>(scene, id, name);
+				else
+					item = collection->make<Item>(scene, id, name);
+				item->m_sourceHandle = source->handle();
+			}
+
+			item->m_visible = obs_data_get_bool(item_data, "visible");
+
+			return item;
+		}
+
 	private:
 
-		Item*
+		std::shared_ptr<Item>
 		buildItem(Scene* scene, uint16_t id, obs_sceneitem_t* obs_item) {
-			Item* item = new Item(scene, id, obs_item);
-			scene->collection()->getSourceByName(item->name())->addReference(&item->m_sourceRef);
+			std::shared_ptr<Item> item = scene->collection()->make<Item>(scene, id, obs_item);
+			item->m_sourceHandle = scene->collection()->getSourceByName(item->name())->handle();
 			return item;
 		}
 
-		Item*
+		std::shared_ptr<Item>
 		buildItemScene(Scene* scene, uint16_t id, obs_sceneitem_t* obs_item) {
-			ItemScene* item = new ItemScene(scene, id, obs_item);
-			scene->collection()->getSceneByName(item->name())->sourcedScene()
-				.addReference(&item->m_sourceRef);
+			std::shared_ptr<ItemScene> item = scene->collection()->make<ItemScene>(scene, id, obs_item);
+			item->m_sourceHandle = scene->collection()->getSceneByName(item->name())->sourcedScene()
+				.handle();
 			return item;
 		}
 
-		Item*
+		std::shared_ptr<Item>
 		buildItemGroup(Scene* scene, uint16_t id, obs_sceneitem_t* obs_item) {
-			ItemGroup* item = new ItemGroup(scene, id, obs_item);
-			scene->collection()->getSourceByName(item->name())->addReference(&item->m_sourceRef);
+			std::shared_ptr<ItemGroup> item = scene->collection()->make<ItemGroup>(scene, id, obs_item);
+			item->m_sourceHandle = scene->collection()->getSourceByName(item->name())->handle();
 			return item;
 		}
 
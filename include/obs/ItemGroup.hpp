@@ -32,8 +32,6 @@ class ItemGroup :
 
 		std::set<Item*> m_items;
 
-		bool m_toggling;
-
 	/*
 	====================================================================================================
 		Constructors / Destructor
@@ -72,4 +70,9 @@ class ItemGroup :
 		bool
 		visible(bool toggle, bool rpc_action = false) override;
 
+	private:
+
+		void
+		collect(std::vector<ItemPtr>& items, std::vector<ItemPtr>& groups);
+
 };
\ No newline at end of file
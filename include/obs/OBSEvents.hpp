@@ -1,5 +1,10 @@
 #pragma once
 
+/*
+ * Plugin Includes
+ */
+#include "include/events/EventTraits.hpp"
+
 /*
 ========================================================================================================
 	Types Predeclarations
@@ -214,4 +219,59 @@ namespace obs {
 
 	}
 
-}
\ No newline at end of file
+}
+
+/*
+========================================================================================================
+	Event Traits
+========================================================================================================
+*/
+
+template<>
+struct event_traits<obs::frontend::event> {
+	static constexpr bool bounded = true;
+	static constexpr size_t size = static_cast<size_t>(obs::frontend::event::SCENE_COLLECTION_CLEANED) + 1;
+	typedef void payload;
+};
+
+template<>
+struct event_traits<obs::save::event> {
+	static constexpr bool bounded = true;
+	static constexpr size_t size = static_cast<size_t>(obs::save::event::LOADING) + 1;
+	typedef const obs::save::data& payload;
+};
+
+template<>
+struct event_traits<obs::output::event> {
+	static constexpr bool bounded = true;
+	static constexpr size_t size = static_cast<size_t>(obs::output::event::RECONNECTED) + 1;
+	typedef const obs::output::data& payload;
+};
+
+template<>
+struct event_traits<obs::collection::event> {
+	static constexpr bool bounded = true;
+	static constexpr size_t size = static_cast<size_t>(obs::collection::event::LIST_BUILD) + 1;
+	typedef void payload;
+};
+
+template<>
+struct event_traits<obs::scene::event> {
+	static constexpr bool bounded = true;
+	static constexpr size_t size = static_cast<size_t>(obs::scene::event::LIST_BUILD) + 1;
+	typedef const obs::scene::data& payload;
+};
+
+template<>
+struct event_traits<obs::item::event> {
+	static constexpr bool bounded = true;
+	static constexpr size_t size = static_cast<size_t>(obs::item::event::LIST_BUILD) + 1;
+	typedef const obs::item::data& payload;
+};
+
+template<>
+struct event_traits<obs::source::event> {
+	static constexpr bool bounded = true;
+	static constexpr size_t size = static_cast<size_t>(obs::source::event::FLAGS) + 1;
+	typedef const obs::source::data& payload;
+};
\ No newline at end of file
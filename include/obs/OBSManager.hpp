@@ -3,8 +3,10 @@
 /*
  * STL Includes
  */
+#include <deque>
 #include <fstream>
 #include <map>
+#include <set>
 #include <vector>
 #include <memory>
 
@@ -19,7 +21,8 @@
  * Plugin Includes
  */
 #include "include/events/EventTrigger.hpp"
-#include "include/common/Memory.hpp"
+#include "include/common/Buffer.hpp"
+#include "include/common/WorkerPool.hpp"
 #include "include/obs/OBSStorage.hpp"
 #include "include/obs/OBSEvents.hpp"
 #include "include/obs/Collection.hpp"
@@ -31,12 +34,26 @@
 #include "include/triggers/SceneItemEventTrigger.hpp"
 #include "include/triggers/SourceEventTrigger.hpp"
 
+/*
+========================================================================================================
+	Defines
+========================================================================================================
+*/
+
+// Sources and scenes attached per event loop iteration after a collection switch
+#define ATTACHMENT_BATCH_SIZE 64
+
 /*
 ========================================================================================================
 	Types Definitions
 ========================================================================================================
 */
 
+typedef struct PendingAttachment {
+	bool scene;
+	uint16_t id;
+} PendingAttachment;
+
 class OBSManager {
 
 	/*
@@ -85,6 +102,29 @@ class OBSManager {
 
 		bool m_isLoadingCollection;
 
+		uint64_t m_version;
+
+		// Threads are started once with the manager, every collections load reuses them
+		WorkerPool m_pool;
+
+		std::deque<PendingAttachment> m_pendingAttachments;
+
+		// Signal handlers are only connected for what clients follow, the ids are the active collection's
+		Collection* m_attachingCollection;
+
+		std::set<uint16_t> m_attachedScenes;
+
+		std::set<uint16_t> m_attachedSources;
+
+		bool m_followScenes;
+
+		bool m_followSources;
+
+		bool m_attachmentScheduled;
+
+		// Expires with the manager, a batch still queued in the event loop is then dropped
+		std::shared_ptr<bool> m_attachmentToken;
+
 	/*
 	====================================================================================================
 		Constructors / Destructor
@@ -104,22 +144,22 @@ class OBSManager {
 	public:
 
 		void
-		addEventHandler(const obs::frontend::event event, EventObserver<obs::frontend::event>* handler);
+		addEventHandler(const obs::frontend::event event, const EventSlot<obs::frontend::event>& handler);
 
 		void
-		addEventHandler(const obs::save::event event, EventObserver<obs::save::event>* handler);
+		addEventHandler(const obs::save::event event, const EventSlot<obs::save::event>& handler);
 
 		void
-		addEventHandler(const obs::output::event event, EventObserver<obs::output::event>* handler);
+		addEventHandler(const obs::output::event event, const EventSlot<obs::output::event>& handler);
 
 		void
-		addEventHandler(const obs::item::event event, EventObserver<obs::item::event>* handler);
+		addEventHandler(const obs::item::event event, const EventSlot<obs::item::event>& handler);
 
 		void
-		addEventHandler(const obs::scene::event event, EventObserver<obs::scene::event>* handler);
+		addEventHandler(const obs::scene::event event, const EventSlot<obs::scene::event>& handler);
 
 		void
-		addEventHandler(const obs::source::event event, EventObserver<obs::source::event>* handler);
+		addEventHandler(const obs::source::event event, const EventSlot<obs::source::event>& handler);
 
 		void
 		registerOutput(obs_output_t* output);
@@ -146,7 +186,19 @@ class OBSManager {
 		unregisterSource(const Source* source);
 
 		void
-		registerAllSourcesScenes();
+		attachSubscribed(bool scenes, bool sources);
+
+		void
+		attachScenes();
+
+		void
+		attachSources();
+
+		void
+		attachScene(Scene* scene);
+
+		void
+		attachSource(Source* source);
 
 		void
 		cleanRegisteredSourcesScenes();
@@ -184,4 +236,18 @@ class OBSManager {
 		Collections
 		collections() const;
 
+		uint64_t
+		version() const;
+
+	private:
+
+		void
+		followActiveCollection();
+
+		void
+		attachPending(size_t count);
+
+		void
+		scheduleAttachment();
+
 };
\ No newline at end of file
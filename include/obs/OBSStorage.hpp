@@ -3,8 +3,28 @@
 /*
  * STL Includes
  */
+#include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <map>
+#include <memory>
 #include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+ * Plugin Includes
+ */
+#include "include/common/NameTable.hpp"
+
+/*
+========================================================================================================
+	Defines
+========================================================================================================
+*/
+
+#define OBS_STORAGE_MIN_SLOTS 16
 
 /*
 ========================================================================================================
@@ -37,7 +57,7 @@ class OBSStorable {
 
 		uint16_t m_identifier;
 
-		std::string m_name;
+		Name m_name;
 
 	/*
 	====================================================================================================
@@ -46,7 +66,7 @@ class OBSStorable {
 	*/
 	protected:
 
-		OBSStorable(uint16_t identifier, const std::string& name) :
+		OBSStorable(uint16_t identifier, const Name& name) :
 			m_identifier(identifier),
 			m_name(name) {
 		}
@@ -60,17 +80,18 @@ class OBSStorable {
 
 		const std::string&
 		name() const {
-			return m_name;
-		}
-
-		std::string&
-		name() {
-			return m_name;
+			return m_name.str();
 		}
 
+		// Renames every holder of an interned name
 		void
 		name(const std::string& name) {
-			m_name = name;
+			m_name.rename(name);
+		}
+
+		const Name&
+		interned() const {
+			return m_name;
 		}
 
 		uint16_t
@@ -101,24 +122,61 @@ class OBSStorage<T, false> {
 	public:
 
 		OBSStorage() {
-			static_assert(false, "T is not OBSStorable");
+			static_assert(is_storable<T>::value, "T is not OBSStorable");
 		}
 
 };
 
+/*
+ * Storables are kept in a dense vector sorted by identifier, iterated in identifier order as the
+ * serialization expects. Names are indexed by an open-addressing table holding entry positions,
+ * looked up from any string view without building a std::string.
+ * Pushes and pops invalidate iterators, and a stored name may only change through move().
+ */
 template<typename T>
 class OBSStorage<T, true> {
 
+	/*
+	====================================================================================================
+		Types Definitions
+	====================================================================================================
+	*/
+	public:
+
+		typedef std::pair<uint16_t, std::shared_ptr<T>> Entry;
+
+		typedef typename std::vector<Entry>::const_iterator const_iterator;
+
+	private:
+
+		// Slots hold entry positions + 1
+		static constexpr uint32_t EMPTY_SLOT = 0;
+
+		static constexpr uint32_t REMOVED_SLOT = UINT32_MAX;
+
 	/*
 	====================================================================================================
 		Instance Data Members
 	====================================================================================================
 	*/
 	private:
-		
-		std::map<uint16_t, std::shared_ptr<T>> m_pointers;
 
-		std::map<std::string, uint16_t> m_idx;
+		std::vector<Entry> m_entries;
+
+		std::vector<uint32_t> m_slots;
+
+		size_t m_used;
+
+	/*
+	====================================================================================================
+		Constructors / Destructor
+	====================================================================================================
+	*/
+	public:
+
+		OBSStorage() :
+			m_used(0) {
+		}
 
 	/*
 	====================================================================================================
@@ -127,84 +185,209 @@ class OBSStorage<T, true> {
 	*/
 	public:
 
-		std::shared_ptr<T>&
+		std::shared_ptr<T>
 		push(T* storable) {
-			std::map<uint16_t, std::shared_ptr<T>>::iterator iter = m_pointers.find(storable->id());
-			if(iter != m_pointers.end()) {
+			// An identifier already stored keeps its storable, the new one isn't owned
+			auto iter = lower(storable->id());
+			if(iter != m_entries.end() && iter->first == storable->id())
 				return iter->second;
-			}
-			
-			m_idx[storable->name()] = storable->id();
-			return m_pointers.emplace(storable->id(), storable).first->second;
+			return push(std::shared_ptr<T>(storable));
 		}
 
-		std::shared_ptr<T>&
+		std::shared_ptr<T>
 		push(const std::shared_ptr<T>& ptr) {
-			std::map<uint16_t, std::shared_ptr<T>>::iterator iter = m_pointers.find(ptr->id());
-			if(iter != m_pointers.end()) {
+			auto iter = lower(ptr->id());
+			if(iter != m_entries.end() && iter->first == ptr->id())
 				return iter->second;
-			}
 
-			m_idx[ptr->name()] = ptr->id();
-			return m_pointers.emplace(ptr->id(), ptr).first->second;
+			// Identifiers mostly grow, the insertion is an append
+			size_t position = iter - m_entries.begin();
+			m_entries.insert(iter, Entry(ptr->id(), ptr));
+			if(position + 1 < m_entries.size())
+				shift(position, 1);
+
+			index(ptr->name(), position, true);
+			return ptr;
 		}
 
 		std::shared_ptr<T>
 		pop(uint16_t identifier) {
-			std::map<uint16_t, std::shared_ptr<T>>::iterator iter = m_pointers.find(identifier);
-			if(iter != m_pointers.end()) {
-				std::shared_ptr<T> ptr = iter->second;
-				m_pointers.erase(iter);
-				m_idx.erase(ptr->name());
-				return ptr;
-			}
-			return nullptr;
+			auto iter = lower(identifier);
+			if(iter == m_entries.end() || iter->first != identifier)
+				return nullptr;
+			return erase(iter - m_entries.begin());
 		}
 
 		std::shared_ptr<T>
-		pop(const std::string& name) {
-			std::map<std::string, uint16_t>::iterator iter = m_idx.find(name);
-			if(iter != m_idx.end()) {
-				std::shared_ptr<T> ptr = m_pointers[iter->second];
-				m_pointers.erase(iter->second);
-				m_idx.erase(iter);
-				return ptr;
-			}
-			return nullptr;
+		pop(std::string_view name) {
+			size_t slot = find(name);
+			if(slot == m_slots.size())
+				return nullptr;
+			return erase(m_slots[slot] - 1);
 		}
 
 		std::shared_ptr<T>
 		move(const std::string name, const std::string new_name) {
-			std::map<std::string, uint16_t>::iterator iter = m_idx.find(name);
-			if(iter != m_idx.end()) {
-				if(name.compare(new_name) == 0) {
-					auto ptr = m_pointers.find(iter->second)->second;
-					return ptr;
-				}
-				else {
-					m_idx.emplace(new_name, iter->second);
-					auto ptr = m_pointers.find(iter->second)->second;
-					ptr->name(new_name);
-					m_idx.erase(iter);
-					return ptr;
+			size_t slot = find(name);
+			if(slot == m_slots.size())
+				return nullptr;
+
+			size_t position = m_slots[slot] - 1;
+			std::shared_ptr<T> ptr = m_entries[position].second;
+			if(name.compare(new_name) == 0)
+				return ptr;
+
+			m_slots[slot] = REMOVED_SLOT;
+			ptr->name(new_name);
+			// A name already indexed keeps its entry
+			index(new_name, position, false);
+			return ptr;
+		}
+
+		// The storable was renamed through a name it shares, it is indexed again under its name
+		bool
+		rename(uint16_t identifier, std::string_view old_name) {
+			auto iter = lower(identifier);
+			if(iter == m_entries.end() || iter->first != identifier)
+				return false;
+
+			size_t position = iter - m_entries.begin();
+			if(!m_slots.empty()) {
+				// The old name can't be compared anymore, its slot is the one holding the position
+				size_t mask = m_slots.size() - 1;
+				for(size_t slot = hash(old_name) & mask; m_slots[slot] != EMPTY_SLOT; slot = (slot + 1) & mask) {
+					if(m_slots[slot] == position + 1) {
+						m_slots[slot] = REMOVED_SLOT;
+						break;
+					}
 				}
 			}
-			return nullptr;
+
+			index(iter->second->name(), position, false);
+			return true;
 		}
 
-		typename std::map<uint16_t, std::shared_ptr<T>>::const_iterator
+		const_iterator
+		locate(std::string_view name) const {
+			size_t slot = find(name);
+			if(slot == m_slots.size())
+				return m_entries.end();
+			return m_entries.begin() + (m_slots[slot] - 1);
+		}
+
+		const_iterator
 		begin() const {
-			return m_pointers.begin();
+			return m_entries.begin();
 		}
 
-		typename std::map<uint16_t, std::shared_ptr<T>>::const_iterator
+		const_iterator
 		end() const {
-			return m_pointers.end();
+			return m_entries.end();
 		}
 
 		size_t
 		size() const {
-			return m_pointers.size();
+			return m_entries.size();
+		}
+
+	private:
+
+		typename std::vector<Entry>::iterator
+		lower(uint16_t identifier) {
+			return std::lower_bound(m_entries.begin(), m_entries.end(), identifier,
+				[](const Entry& entry, uint16_t id) { return entry.first < id; });
+		}
+
+		typename std::vector<Entry>::const_iterator
+		lower(uint16_t identifier) const {
+			return std::lower_bound(m_entries.begin(), m_entries.end(), identifier,
+				[](const Entry& entry, uint16_t id) { return entry.first < id; });
+		}
+
+		static size_t
+		hash(std::string_view name) {
+			return std::hash<std::string_view>()(name);
+		}
+
+		size_t
+		find(std::string_view name) const {
+			if(m_slots.empty())
+				return m_slots.size();
+
+			size_t mask = m_slots.size() - 1;
+			for(size_t slot = hash(name) & mask; m_slots[slot] != EMPTY_SLOT; slot = (slot + 1) & mask) {
+				if(m_slots[slot] != REMOVED_SLOT && m_entries[m_slots[slot] - 1].second->name() == name)
+					return slot;
+			}
+			return m_slots.size();
+		}
+
+		void
+		index(std::string_view name, size_t position, bool replace) {
+			size_t slot = find(name);
+			if(slot != m_slots.size()) {
+				if(replace)
+					m_slots[slot] = static_cast<uint32_t>(position + 1);
+				return;
+			}
+
+			if((m_used + 1) * 4 > m_slots.size() * 3)
+				rehash();
+
+			size_t mask = m_slots.size() - 1;
+			slot = hash(name) & mask;
+			while(m_slots[slot] != EMPTY_SLOT && m_slots[slot] != REMOVED_SLOT)
+				slot = (slot + 1) & mask;
+
+			if(m_slots[slot] == EMPTY_SLOT)
+				m_used++;
+			m_slots[slot] = static_cast<uint32_t>(position + 1);
+		}
+
+		void
+		rehash() {
+			size_t capacity = OBS_STORAGE_MIN_SLOTS;
+			while(capacity * 3 < (m_entries.size() + 1) * 4 * 2)
+				capacity <<= 1;
+
+			std::vector<uint32_t> slots;
+			slots.swap(m_slots);
+			m_slots.assign(capacity, EMPTY_SLOT);
+			m_used = 0;
+
+			size_t mask = capacity - 1;
+			for(auto iter = slots.begin(); iter != slots.end(); iter++) {
+				if(*iter == EMPTY_SLOT || *iter == REMOVED_SLOT)
+					continue;
+				size_t slot = hash(m_entries[*iter - 1].second->name()) & mask;
+				while(m_slots[slot] != EMPTY_SLOT)
+					slot = (slot + 1) & mask;
+				m_slots[slot] = *iter;
+				m_used++;
+			}
+		}
+
+		void
+		shift(size_t from, int offset) {
+			// Entries moved in the vector, positions past the change are fixed up
+			for(auto iter = m_slots.begin(); iter != m_slots.end(); iter++) {
+				if(*iter != EMPTY_SLOT && *iter != REMOVED_SLOT && *iter - 1 >= from + (offset < 0 ? 1 : 0))
+					*iter = static_cast<uint32_t>(*iter + offset);
+			}
+		}
+
+		std::shared_ptr<T>
+		erase(size_t position) {
+			std::shared_ptr<T> ptr = m_entries[position].second;
+
+			// The name is only unindexed when it designates this entry
+			size_t slot = find(ptr->name());
+			if(slot != m_slots.size() && m_slots[slot] - 1 == position)
+				m_slots[slot] = REMOVED_SLOT;
+
+			m_entries.erase(m_entries.begin() + position);
+			shift(position, -1);
+			return ptr;
 		}
 
 	/*
@@ -215,23 +398,19 @@ class OBSStorage<T, true> {
 	public:
 
 		T*
-		operator[](const std::string& name) const {
-			std::map<std::string, uint16_t>::const_iterator iter = m_idx.find(name);
-			if(iter != m_idx.end()) {
-				T* ptr = m_pointers.find(iter->second)->second.get();
-				return ptr;
-			}
-			return nullptr;
+		operator[](std::string_view name) const {
+			size_t slot = find(name);
+			if(slot == m_slots.size())
+				return nullptr;
+			return m_entries[m_slots[slot] - 1].second.get();
 		}
 
 		T*
 		operator[](uint16_t identifier) const {
-			std::map<uint16_t, std::shared_ptr<T>>::const_iterator iter = m_pointers.find(identifier);
-			if(iter != m_pointers.end()) {
-				T* ptr = iter->second.get();
-				return ptr;
-			}
-			return nullptr;
+			auto iter = lower(identifier);
+			if(iter == m_entries.end() || iter->first != identifier)
+				return nullptr;
+			return iter->second.get();
 		}
 
 };
\ No newline at end of file
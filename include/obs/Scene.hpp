@@ -6,6 +6,7 @@
 #include <map>
 #include <vector>
 #include <memory>
+#include <string_view>
 
 /*
  * OBS Includes
@@ -17,7 +18,7 @@
 /*
  * Plugin Includes
  */
-#include "include/common/Memory.hpp"
+#include "include/common/Buffer.hpp"
 #include "include/obs/OBSStorage.hpp"
 #include "include/obs/Source.hpp"
 #include "include/obs/Item.hpp"
@@ -32,6 +33,8 @@ class Source;
 
 class Scene;
 
+class ItemGroup;
+
 class Collection;
 
 /*
@@ -42,30 +45,49 @@ class Collection;
 
 typedef Scene* ScenePtr;
 
+// Items of the groups of a collection file, by group name
+typedef std::map<std::string, obs_data_array_t*> GroupItems;
+
 typedef struct Scenes {
 	const Collection* collection;
 	std::vector<ScenePtr> scenes;
 } Scenes;
 
+// Place of an item in the OBS order of its scene, grouped items follow their group
+typedef struct ItemPlace {
+	uint16_t id;
+	// Identifier of the group holding the item, 0 at the root of the scene
+	uint16_t group;
+} ItemPlace;
+
 class Scene : public OBSStorable {
 
 	/*
 	====================================================================================================
-		Constants
+		Static Class Functions
 	====================================================================================================
 	*/
 	public:
 
-		static const unsigned int MAX_NAME_LENGTH = 99;
+		static std::shared_ptr<Scene> buildFromBuffer(Collection* collection, BufferReader& reader);
+
+		static bool
+		ApplyingBatch();
+
+	private:
+
+		static bool
+		EnumerateOrder(obs_scene_t* scene, obs_sceneitem_t* item, void* private_data);
 
 	/*
 	====================================================================================================
-		Static Class Functions
+		Static Class Attributes
 	====================================================================================================
 	*/
-	public:
+	private:
 
-		static Scene* buildFromMemory(Collection* collection, Memory& memory);
+		// OBS signals a visibility change from the thread applying it
+		static thread_local int _visibility_batches;
 
 	/*
 	====================================================================================================
@@ -76,14 +98,21 @@ class Scene : public OBSStorable {
 
 		OBSStorage<Item> m_items;
 
+		// Items in the order OBS draws them, bottom first
+		std::vector<ItemPlace> m_order;
+
 		Source m_internalSource;
 
 		Collection* m_parentCollection;
 
+		Handle<Scene> m_handle;
+
 		obs_scene_t* m_scene;
 
 		obs_source_t* m_source;
 
+		uint64_t m_version;
+
 	/*
 	====================================================================================================
 		Constructors / Destructor
@@ -119,15 +148,46 @@ class Scene : public OBSStorable {
 		void
 		synchronize();
 
+		bool
+		reorder();
+
+		bool
+		visible(
+			const std::vector<ItemPtr>& items,
+			bool toggle,
+			const std::vector<ItemPtr>& groups = std::vector<ItemPtr>()
+		);
+
+		void
+		load(obs_data_t* data, const GroupItems& groups);
+
 		Collection*
 		collection() const;
 
+		Handle<Scene>
+		handle() const;
+
+		void
+		unlink();
+
+		void
+		reindex(std::string_view old_name, const Name& name);
+
 		Items
 		items() const;
 
+		Items
+		ordered() const;
+
 		unsigned int
 		itemCount() const;
 
+		uint64_t
+		version() const;
+
+		uint64_t
+		touch();
+
 		obs_scene_t*
 		scene() const;
 
@@ -137,10 +197,24 @@ class Scene : public OBSStorable {
 		Source&
 		sourcedScene();
 
+		const Source&
+		sourcedScene() const;
+
 		void
 		source(obs_source_t* obs_source);
 
-		Memory
-		toMemory(size_t& size) const;
+		void
+		toBuffer(BufferWriter& writer) const;
+
+	private:
+
+		void
+		loadItems(obs_data_array_t* items, ItemGroup* owner, const GroupItems& groups);
+
+		void
+		place(uint16_t id, uint16_t group, size_t position);
+
+		std::vector<ItemPlace>
+		enumerate() const;
 
 };
\ No newline at end of file
@@ -0,0 +1,69 @@
+#pragma once
+
+/*
+ * STL Includes
+ */
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/*
+ * Plugin Includes
+ */
+#include "include/common/NameTable.hpp"
+
+/*
+========================================================================================================
+	Types Definitions
+========================================================================================================
+*/
+
+typedef struct ItemNode {
+	uint16_t id;
+	// Static string of the item kind
+	const char* type;
+	// Registrable flag << 16 + source id, as in the wire identifiers
+	uint32_t source;
+	bool visible;
+} ItemNode;
+
+typedef struct SceneNode {
+	uint16_t id;
+	Name name;
+	// Items as Scene::items() lists them, the ones whose source left the collection aren't listed
+	std::vector<ItemNode> items;
+	unsigned int itemCount;
+} SceneNode;
+
+typedef struct SourceNode {
+	// Registrable flag << 16 + source id, as in the wire identifiers
+	uint32_t key;
+	Name name;
+	std::string type;
+	bool audio;
+	bool muted;
+} SourceNode;
+
+typedef std::shared_ptr<const SceneNode> SceneNodePtr;
+
+typedef std::shared_ptr<const SourceNode> SourceNodePtr;
+
+/*
+ * Immutable copy of a collection, published on every change by the thread mutating it. A version
+ * still held by a reader is copied before the next change, the nodes a change didn't reach are
+ * shared between them. Names are standalone copies, renaming the live objects doesn't reach a
+ * published snapshot.
+ */
+typedef struct Snapshot {
+	uint16_t collection;
+	uint64_t revision;
+	// Visibility and mute states are kept as OBS last reported them, they only hold in the
+	// active collection
+	bool active;
+	// Ordered by identifier, and by key for the sources
+	std::vector<SceneNodePtr> scenes;
+	std::vector<SourceNodePtr> sources;
+} Snapshot;
+
+typedef std::shared_ptr<const Snapshot> SnapshotPtr;
\ No newline at end of file
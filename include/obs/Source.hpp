@@ -21,7 +21,8 @@
 /*
  * Plugin Includes
  */
-#include "include/common/Memory.hpp"
+#include "include/common/Buffer.hpp"
+#include "include/common/SlotMap.hpp"
 #include "include/obs/OBSStorage.hpp"
 
 /*
@@ -49,14 +50,7 @@ typedef struct Sources {
 
 class Source : public OBSStorable {
 
-	/*
-	====================================================================================================
-		Constants
-	====================================================================================================
-	*/
-	public:
-
-		static const unsigned int MAX_NAME_LENGTH = 99;
+	friend class Collection;
 
 	/*
 	====================================================================================================
@@ -65,7 +59,7 @@ class Source : public OBSStorable {
 	*/
 	public:
 
-		static Source* buildFromMemory(Collection* collection, Memory& memory);
+		static std::shared_ptr<Source> buildFromBuffer(Collection* collection, BufferReader& reader);
 
 	/*
 	====================================================================================================
@@ -74,10 +68,10 @@ class Source : public OBSStorable {
 	*/
 	private:
 
-		std::set<Source**> m_references;
-
 		Collection* m_parentCollection;
 
+		Handle<Source> m_handle;
+
 		obs_source_t* m_source;
 
 		std::string m_type;
@@ -108,17 +102,14 @@ class Source : public OBSStorable {
 	*/
 	public:
 
-		void
-		addReference(Source** source);
-
-		void
-		removeReference(Source** source);
+		Handle<Source>
+		handle() const;
 
 		bool
 		registrable() const;
 
-		Memory
-		toMemory(size_t& size) const;
+		void
+		toBuffer(BufferWriter& writer) const;
 
 		Collection*
 		collection() const;
@@ -126,6 +117,9 @@ class Source : public OBSStorable {
 		void
 		source(obs_source_t* obs_source);
 
+		void
+		load(obs_data_t* data);
+
 		obs_source_t*
 		source() const;
 
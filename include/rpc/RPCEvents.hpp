@@ -13,6 +13,11 @@
 #include <QJsonObject>
 #include <QJsonArray>
 
+/*
+ * Plugin Includes
+ */
+#include "include/events/EventTraits.hpp"
+
 /*
 ========================================================================================================
 	Types Predeclarations
@@ -74,6 +79,10 @@ namespace rpc {
 		COLLECTION_UPDATED_SUBSCRIBE = 32,
 		RECORDING_STATUS_CHANGED_SUBSCRIBE = 33,
 
+		// Not part of the Streamdeck protocol, clients opt in explicitly
+		DELTAS_SUBSCRIBE = 34,
+		ACKNOWLEDGE_REVISION = 35,
+
 		COUNT,
 	};
 
@@ -109,4 +118,18 @@ namespace rpc {
 		};
 	};
 
-}
\ No newline at end of file
+}
+
+/*
+========================================================================================================
+	Event Traits
+========================================================================================================
+*/
+
+// ERROR sits below the table and can't be observed
+template<>
+struct event_traits<rpc::event> {
+	static constexpr bool bounded = true;
+	static constexpr size_t size = static_cast<size_t>(rpc::event::COUNT);
+	typedef const rpc::request& payload;
+};
\ No newline at end of file
@@ -0,0 +1,212 @@
+#pragma once
+
+/*
+ * Std Includes
+ */
+#include <string>
+#include <vector>
+
+/*
+ * Qt Includes
+ */
+#include <QByteArray>
+#include <QMetaType>
+#include <QString>
+#include <QVariant>
+#include <QVector>
+
+/*
+ * Plugin Includes
+ */
+#include "include/rpc/RPCEvents.hpp"
+
+/*
+========================================================================================================
+	Defines
+========================================================================================================
+*/
+
+#define RPC_FRAME_BUFFER_SIZE 4096
+
+#define RPC_MAX_FRAME_SIZE (1 << 20)
+
+#define RPC_MAX_DEPTH 32
+
+/*
+========================================================================================================
+	Types Definitions
+========================================================================================================
+*/
+
+namespace rpc {
+
+	/*
+	====================================================================================================
+		Inbound Message
+	====================================================================================================
+	*/
+
+	struct message {
+		event event;
+		QString service;
+		QString method;
+		QVector<QVariant> args;
+		// Only kept when the event is not understood, for logging purpose
+		QByteArray frame;
+	};
+
+	/*
+	====================================================================================================
+		Framing
+	====================================================================================================
+	*/
+
+	class frame_buffer {
+
+		/*
+		================================================================================================
+			Instance Data Members
+		================================================================================================
+		*/
+		private:
+
+			std::vector<char> m_data;
+
+			size_t m_head;
+
+			size_t m_size;
+
+			size_t m_scanned;
+
+		/*
+		================================================================================================
+			Constructors / Destructor
+		================================================================================================
+		*/
+		public:
+
+			frame_buffer(size_t capacity = RPC_FRAME_BUFFER_SIZE);
+
+			~frame_buffer();
+
+		/*
+		================================================================================================
+			Instance Methods
+		================================================================================================
+		*/
+		public:
+
+			size_t
+			size() const;
+
+			char*
+			reserve(size_t& length);
+
+			void
+			commit(size_t length);
+
+			bool
+			next(const char*& frame, size_t& length);
+
+		private:
+
+			void
+			linearize();
+
+	};
+
+	/*
+	====================================================================================================
+		Parsing
+	====================================================================================================
+	*/
+
+	class parser {
+
+		/*
+		================================================================================================
+			Static Class Functions
+		================================================================================================
+		*/
+		public:
+
+			static bool
+			parse(const char* data, size_t length, message& message);
+
+		/*
+		================================================================================================
+			Instance Data Members
+		================================================================================================
+		*/
+		private:
+
+			const char* m_current;
+
+			const char* m_end;
+
+			int m_depth;
+
+			std::string m_scratch;
+
+			bool m_hasSceneId;
+
+			bool m_hasSceneItemId;
+
+			bool m_hasSourceId;
+
+			QString m_sceneId;
+
+			QString m_sceneItemId;
+
+			QString m_sourceId;
+
+		/*
+		================================================================================================
+			Constructors / Destructor
+		================================================================================================
+		*/
+		private:
+
+			parser(const char* data, size_t length);
+
+			~parser();
+
+		/*
+		================================================================================================
+			Instance Methods
+		================================================================================================
+		*/
+		private:
+
+			bool
+			parseRoot(message& message);
+
+			bool
+			parseParams(message& message);
+
+			bool
+			parseKey(const char*& key, size_t& length);
+
+			bool
+			parseString(QString* value);
+
+			bool
+			parseNumber(double* value);
+
+			bool
+			parseValue(QVariant* value);
+
+			bool
+			skipValue();
+
+			bool
+			expect(char c);
+
+			char
+			peek();
+
+	};
+
+}
+
+Q_DECLARE_METATYPE(rpc::message)
\ No newline at end of file
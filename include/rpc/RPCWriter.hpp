@@ -0,0 +1,240 @@
+#pragma once
+
+/*
+ * Std Includes
+ */
+#include <cstdint>
+#include <string>
+
+/*
+ * Qt Includes
+ */
+#include <QByteArray>
+#include <QMetaType>
+#include <QString>
+#include <QVector>
+
+/*
+ * Plugin Includes
+ */
+#include "include/common/NameTable.hpp"
+#include "include/rpc/RPCEvents.hpp"
+
+/*
+========================================================================================================
+	Defines
+========================================================================================================
+*/
+
+#define RPC_WRITER_MAX_DEPTH 64
+
+/*
+========================================================================================================
+	Types Definitions
+========================================================================================================
+*/
+
+namespace rpc {
+
+	/*
+	====================================================================================================
+		JSON Writer
+	====================================================================================================
+	*/
+
+	/*
+	 * Emits compact JSON directly into a byte buffer (QByteArray, std::string...).
+	 * The output is byte-identical to QJsonDocument::Compact as long as the caller writes the keys
+	 * of each object in the order QJsonObject sorts them.
+	 */
+	template<typename Buffer>
+	class json_writer {
+
+		/*
+		================================================================================================
+			Instance Data Members
+		================================================================================================
+		*/
+		private:
+
+			Buffer& m_buffer;
+
+			uint64_t m_firstElement;
+
+			int m_depth;
+
+		/*
+		================================================================================================
+			Constructors / Destructor
+		================================================================================================
+		*/
+		public:
+
+			json_writer(Buffer& buffer);
+
+			~json_writer();
+
+		/*
+		================================================================================================
+			Instance Methods
+		================================================================================================
+		*/
+		public:
+
+			json_writer&
+			beginObject();
+
+			json_writer&
+			endObject();
+
+			json_writer&
+			beginArray();
+
+			json_writer&
+			endArray();
+
+			json_writer&
+			key(const char* name);
+
+			json_writer&
+			value(const char* string);
+
+			json_writer&
+			value(const std::string& string);
+
+			json_writer&
+			value(const QString& string);
+
+			json_writer&
+			value(const Name& name);
+
+			json_writer&
+			value(bool boolean);
+
+			json_writer&
+			value(int32_t number);
+
+			json_writer&
+			quoted(uint64_t number);
+
+			json_writer&
+			escaped(const char* data, size_t length);
+
+			template<typename T>
+			json_writer&
+			field(const char* name, const T& field_value);
+
+			json_writer&
+			endLine();
+
+		private:
+
+			void
+			separator();
+
+			void
+			integer(uint64_t number, bool negative);
+
+			void
+			escape(const char* data, size_t length);
+
+	};
+
+	/*
+	====================================================================================================
+		Rendered Frame
+	====================================================================================================
+	*/
+
+	/*
+	 * A response serialized once and shared by every client it is broadcast to. The bytes are
+	 * implicitly shared, only the per-client resourceId is spliced in when a splice point is set.
+	 * A superseding frame only replaces pending frames of the same event and scope (collection).
+	 */
+	class frame {
+
+		/*
+		================================================================================================
+			Instance Data Members
+		================================================================================================
+		*/
+		private:
+
+			QByteArray m_data;
+
+			int m_splice;
+
+			bool m_superseding;
+
+			uint64_t m_scope;
+
+		/*
+		================================================================================================
+			Constructors / Destructor
+		================================================================================================
+		*/
+		public:
+
+			frame();
+
+			frame(const QByteArray& data, int splice = -1, bool superseding = false, uint64_t scope = 0);
+
+			~frame();
+
+		/*
+		================================================================================================
+			Instance Methods
+		================================================================================================
+		*/
+		public:
+
+			bool
+			empty() const;
+
+			bool
+			spliced() const;
+
+			int
+			splice() const;
+
+			bool
+			superseding() const;
+
+			uint64_t
+			scope() const;
+
+			const QByteArray&
+			data() const;
+
+			QByteArray
+			render(const std::string& resource) const;
+
+	};
+
+	/*
+	====================================================================================================
+		Outbound Messages
+	====================================================================================================
+	*/
+
+	struct outbound {
+		event event;
+		// Broadcast states may be superseded by a newer message of the same event and scope
+		bool mergeable;
+		uint64_t scope;
+		QByteArray data;
+	};
+
+	typedef QVector<outbound> batch;
+
+}
+
+Q_DECLARE_METATYPE(rpc::batch)
+
+/*
+========================================================================================================
+	Template Definitions
+========================================================================================================
+*/
+
+#include "template/rpc/RPCWriter.tpp"
\ No newline at end of file
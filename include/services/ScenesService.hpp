@@ -88,4 +88,10 @@ class ScenesService : public ServiceImpl<ScenesService> {
 		bool
 		onMakeSceneActive(const rpc::request& data);
 
+		bool
+		subscribeDeltas(const rpc::request& data);
+
+		bool
+		onAcknowledgeRevision(const rpc::request& data);
+
 };
\ No newline at end of file
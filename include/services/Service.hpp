@@ -19,7 +19,7 @@
 /*
  * Plugin Includes
  */
-#include "include/events/EventObservable.hpp"
+#include "include/events/EventSlot.hpp"
 #include "include/obs/OBSEvents.hpp"
 #include "include/rpc/RPCEvents.hpp"
 
@@ -85,34 +85,7 @@ class Service {
 };
 
 template<typename T>
-class ServiceImpl : public Service,
-	private EventObserver<T, obs::frontend::event>,
-	private EventObserver<T, obs::save::event>,
-	private EventObserver<T, obs::output::event>,
-	private EventObserver<T, obs::item::event>,
-	private EventObserver<T, obs::scene::event>,
-	private EventObserver<T, obs::source::event> {
-
-	/*
-	====================================================================================================
-		Types Aliases
-	====================================================================================================
-	*/
-	private:
-
-		using FrontendHandler = EventObserver<T, obs::frontend::event>;
-
-		using SaveHandler = EventObserver<T, obs::save::event>;
-
-		using OutputHandler = EventObserver<T, obs::output::event>;
-
-		using ItemHandler = EventObserver<T, obs::item::event>;
-
-		using SourceHandler = EventObserver<T, obs::source::event>;
-
-		using SceneHandler = EventObserver<T, obs::scene::event>;
-
-		using RPCHandler = EventObserver<T, rpc::event>;
+class ServiceImpl : public Service {
 
 	/*
 	====================================================================================================
@@ -121,46 +94,19 @@ class ServiceImpl : public Service,
 	*/
 	private:
 
-		typedef 
-		typename FrontendHandler::template FuncWrapperB<void>::Callback
-		obs_frontend_callback;
+		typedef bool (T::*obs_frontend_callback)();
 
-		typedef 
-		typename SaveHandler::template FuncWrapperB<const obs::save::data&>::Callback
-		obs_save_callback;
+		typedef bool (T::*obs_save_callback)(const obs::save::data&);
 
-		typedef
-		typename OutputHandler::template FuncWrapperB<const obs::output::data&>::Callback
-		obs_output_callback;
+		typedef bool (T::*obs_output_callback)(const obs::output::data&);
 
-		typedef
-		typename ItemHandler::template FuncWrapperB<const obs::item::data&>::Callback
-		obs_item_callback;
+		typedef bool (T::*obs_item_callback)(const obs::item::data&);
 
-		typedef
-		typename SourceHandler::template FuncWrapperB<const obs::source::data&>::Callback
-		obs_source_callback;
+		typedef bool (T::*obs_source_callback)(const obs::source::data&);
 
-		typedef
-		typename SceneHandler::template FuncWrapperB<const obs::scene::data&>::Callback
-		obs_scene_callback;
+		typedef bool (T::*obs_scene_callback)(const obs::scene::data&);
 
-		typedef
-		typename RPCHandler::template FuncWrapperB<void>::Callback
-		rpc_callback_void;
-
-		typedef
-		typename RPCHandler::template FuncWrapperB<const rpc::request&>::Callback
-		rpc_callback_typed;
-
-	/*
-	====================================================================================================
-		Instance Data Members
-	====================================================================================================
-	*/
-	protected:
-
-		RPCHandler m_rpcEvent;
+		typedef bool (T::*rpc_callback)(const rpc::request&);
 
 	/*
 	====================================================================================================
@@ -210,6 +156,9 @@ class ServiceImpl : public Service,
 		rpc::response<Sources>
 		response_sources(const rpc::request* data, const char* method) const;
 
+		rpc::response<Revision>
+		response_revision(const rpc::request* data, const char* method) const;
+
 		void
 		setupEvent(obs::frontend::event event, obs_frontend_callback handler);
 
@@ -229,10 +178,7 @@ class ServiceImpl : public Service,
 		setupEvent(obs::scene::event event, obs_scene_callback handler);
 
 		void
-		setupEvent(rpc::event event, rpc_callback_void handler);
-
-		void
-		setupEvent(rpc::event event, rpc_callback_typed handler);
+		setupEvent(rpc::event event, rpc_callback handler);
 
 		bool
 		checkResource(const rpc::request* data, const QRegExp& regex) const;
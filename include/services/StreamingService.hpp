@@ -14,7 +14,6 @@
  * Plugin Includes
  */
 #include "include/services/Service.hpp"
-#include "include/events/EventObserver.hpp"
 #include "include/streamdeck/StreamDeckManager.hpp"
 
  /*
@@ -12,11 +12,14 @@
 #include <QJsonArray>
 #include <QJsonObject>
 #include <QThread>
+#include <QElapsedTimer>
 
 /*
  * STL Includes
  */
+#include <atomic>
 #include <mutex>
+#include <set>
 #include <thread>
 #include <vector>
 
@@ -24,8 +27,22 @@
  * Plugin Includes
  */
 #include "include/rpc/RPCEvents.hpp"
+#include "include/rpc/RPCParser.hpp"
+#include "include/rpc/RPCWriter.hpp"
 #include "include/obs/Collection.hpp"
 
+/*
+========================================================================================================
+	Defines
+========================================================================================================
+*/
+
+#define STREAMDECK_HIGH_WATERMARK (256 * 1024)
+
+#define STREAMDECK_LOW_WATERMARK (64 * 1024)
+
+#define STREAMDECK_MAX_PENDING (8 * 1024 * 1024)
+
 /*
 ========================================================================================================
 	Types Predeclarations
@@ -40,10 +57,61 @@ class Streamdeck;
 ========================================================================================================
 */
 
-class StreamdeckClient : public QThread {
+class StreamdeckReactor : public QThread {
+
+	friend class StreamdeckClient;
+
+	Q_OBJECT
+
+	/*
+	====================================================================================================
+		Instance Data Members
+	====================================================================================================
+	*/
+	private:
+
+		std::atomic<int> m_clients;
+
+		// Clients living on this thread, destroyed by it when the reactor stops
+		std::set<StreamdeckClient*> m_members;
+
+		std::mutex m_membersLock;
+
+		// Lives on the reactor thread, runs the shutdown there
+		QObject* m_context;
+
+	/*
+	====================================================================================================
+		Constructors / Destructor
+	====================================================================================================
+	*/
+	public:
+
+		StreamdeckReactor(QObject* parent = nullptr);
+
+		~StreamdeckReactor();
+
+	/*
+	====================================================================================================
+		Instance Methods
+	====================================================================================================
+	*/
+	public:
+
+		int
+		load() const;
+
+		void
+		stop();
+
+};
+
+class StreamdeckClient : public QObject {
 
 	friend class Streamdeck;
 
+	friend class StreamdeckReactor;
+
 	Q_OBJECT
 
 	/*
@@ -55,6 +123,22 @@ class StreamdeckClient : public QThread {
 
 		static bool _is_verbose;
 
+		static std::atomic<qint64> _high_watermark;
+
+		static std::atomic<qint64> _low_watermark;
+
+		static std::atomic<qint64> _max_pending;
+
+	/*
+	====================================================================================================
+		Static Class Functions
+	====================================================================================================
+	*/
+	public:
+
+		static void
+		setWatermarks(qint64 high, qint64 low, qint64 max_pending = STREAMDECK_MAX_PENDING);
+
 	/*
 	====================================================================================================
 		Instance Data Members
@@ -66,7 +150,21 @@ class StreamdeckClient : public QThread {
 
 		qintptr m_socketDescriptor;
 
-		volatile bool m_startExecution;
+		StreamdeckReactor* m_reactor;
+
+		std::atomic<bool> m_connected;
+
+		QElapsedTimer m_acceptTimer;
+
+		rpc::frame_buffer m_inbound;
+
+		QQueue<rpc::outbound> m_outbound;
+
+		qint64 m_outboundBytes;
+
+		std::atomic<int> m_queueDepth;
+
+		std::atomic<qint64> m_bytesPending;
 
 	/*
 	====================================================================================================
@@ -75,7 +173,7 @@ class StreamdeckClient : public QThread {
 	*/
 	private:
 
-		StreamdeckClient(qintptr socket_descriptor);
+		StreamdeckClient(qintptr socket_descriptor, StreamdeckReactor* reactor);
 
 		~StreamdeckClient();
 
@@ -89,13 +187,20 @@ class StreamdeckClient : public QThread {
 		QTcpSocket*
 		socket() const;
 
-		void
-		ready();
+		bool
+		isConnected() const;
 
-	protected:
+		int
+		queueDepth() const;
+
+		qint64
+		bytesPending() const;
 
 		void
-		run() override final;
+		accept();
+
+		void
+		ready();
 
 	/*
 	====================================================================================================
@@ -104,6 +209,12 @@ class StreamdeckClient : public QThread {
 	*/
 	private slots:
 
+		void
+		open();
+
+		void
+		start();
+
 		void
 		close();
 
@@ -114,13 +225,24 @@ class StreamdeckClient : public QThread {
 		read();
 
 		void
-		write(QJsonDocument data);
+		write(rpc::batch batch);
+
+		void
+		flush();
+
+		void
+		written(qint64 bytes);
 
 	/*
 	====================================================================================================
 		Signals
 	====================================================================================================
 	*/
+	signals:
+
+		void
+		opened(StreamdeckClient* client, bool success);
+
 	signals:
 
 		void
@@ -129,7 +251,7 @@ class StreamdeckClient : public QThread {
 	signals:
 
 		void
-		read(QJsonDocument data);
+		read(rpc::message message);
 
 };
 
@@ -158,7 +280,7 @@ class Streamdeck : public QObject {
 	public:
 
 		static StreamdeckClient*
-		createClient(qintptr socket_descriptor);
+		createClient(qintptr socket_descriptor, StreamdeckReactor* reactor);
 
 		static QJsonObject
 		buildJsonResponse(const rpc::event event, const QString& resource, bool event_mode = false);
@@ -178,6 +300,68 @@ class Streamdeck : public QObject {
 		static void
 		addToJsonArray(QJsonValueRef&& json_array, QJsonValue&& value);
 
+		static void
+		writeItems(
+			rpc::json_writer<QByteArray>& json,
+			const char* key,
+			uint64_t collection_id,
+			bool active,
+			const SceneNode& scene
+		);
+
+		static void
+		writeScene(
+			rpc::json_writer<QByteArray>& json,
+			uint64_t collection_id,
+			bool active,
+			const SceneNode& scene
+		);
+
+		static void
+		writeSource(
+			rpc::json_writer<QByteArray>& json,
+			uint64_t collection_id,
+			bool active,
+			const SourceNode& source
+		);
+
+		static void
+		renderCollections(
+			QByteArray& output,
+			const rpc::event event,
+			const std::string& resource,
+			const Collections& collections,
+			bool event_mode = false
+		);
+
+		static void
+		renderScenes(
+			QByteArray& output,
+			const rpc::event event,
+			const std::string& resource,
+			const Scenes& scenes,
+			bool event_mode = false
+		);
+
+		static void
+		renderSources(
+			QByteArray& output,
+			const rpc::event event,
+			const std::string& resource,
+			const Sources& sources,
+			bool event_mode = false
+		);
+
+		template<typename T>
+		static rpc::frame
+		renderEvent(const T& data);
+
+		static rpc::frame
+		renderEvent();
+
+		static rpc::frame
+		renderDelta(const Delta& delta, const Snapshot& snapshot);
+
 	/*
 	====================================================================================================
 		Instance Data Members
@@ -191,6 +375,16 @@ class Streamdeck : public QObject {
 
 		StreamdeckClient& m_internalClient;
 
+		QByteArray m_output;
+
+		rpc::batch m_pending;
+
+		bool m_deltaMode;
+
+		uint16_t m_deltaCollection;
+
+		Revision m_acknowledgedRevision;
+
 	/*
 	====================================================================================================
 		Constructors / Destructors
@@ -213,18 +407,23 @@ class Streamdeck : public QObject {
 		close();
 
 		void
-		parse(
-			const QJsonDocument& json_quest,
-			rpc::event& event,
-			QString& service,
-			QString& method,
-			QVector<QVariant>& args
+		send(
+			const rpc::event event,
+			const QJsonDocument& json_quest
 		);
 
 		void
 		send(
 			const rpc::event event,
-			const QJsonDocument& json_quest
+			const QByteArray& data,
+			bool mergeable = false,
+			uint64_t scope = 0
+		);
+
+		bool
+		sendFrame(
+			const rpc::event event,
+			const rpc::frame& frame
 		);
 
 		bool
@@ -345,10 +544,31 @@ class Streamdeck : public QObject {
 		void
 		unlockEventAuthorizations(const rpc::event event);
 
+		void
+		enableDeltas(uint16_t collection);
+
+		bool
+		followsDeltas(const Collection* collection) const;
+
+		bool
+		subscribed(const rpc::event event) const;
+
+		bool
+		supersededByDeltas(const rpc::event event) const;
+
+		uint64_t
+		acknowledgedRevision(const Collection* collection) const;
+
+		void
+		acknowledgeRevision(const Revision& revision);
+
 	private:
 
+		QByteArray&
+		outputBuffer();
+
 		void
-		logEvent(const rpc::event event, const QJsonDocument& json_quest);
+		logEvent(const rpc::event event, const QByteArray& frame);
 
 	/*
 	====================================================================================================
@@ -361,7 +581,12 @@ class Streamdeck : public QObject {
 		disconnected(int code);
 
 		void
-		read(QJsonDocument data);
+		read(rpc::message message);
+
+	private slots:
+
+		void
+		flush();
 	
 	/*
 	====================================================================================================
@@ -393,7 +618,7 @@ class Streamdeck : public QObject {
 	signals:
 
 		void
-		write(QJsonDocument data);
+		write(rpc::batch batch);
 
 };
 
@@ -11,6 +11,14 @@
 #include <QLocalSocket>
 #include <QSet>
 
+/*
+ * STL Includes
+ */
+#include <bitset>
+#include <initializer_list>
+#include <map>
+#include <tuple>
+
 /*
  * Plugin Includes
  */
@@ -28,6 +36,10 @@
 
 #define OBS_PORT 28195
 
+#define MAX_REACTORS 4
+
+#define COALESCING_WINDOW 16
+
 /*
 ========================================================================================================
 	Types Predeclarations
@@ -42,6 +54,14 @@ class StreamdeckManager;
 ========================================================================================================
 */
 
+typedef struct CachedResponse {
+	uint64_t version;
+	rpc::frame frame;
+} CachedResponse;
+
+// Answers are cached per event, element and resource, each client keeps its own resourceId
+typedef std::tuple<rpc::event, uint16_t, std::string> CacheKey;
+
 class StreamdeckServer : private QTcpServer {
 	
 	friend class StreamdeckManager;
@@ -57,6 +77,8 @@ class StreamdeckServer : private QTcpServer {
 
 		QMap<QTcpSocket*, StreamdeckClient*> m_pendingClients;
 
+		QVector<StreamdeckReactor*> m_reactors;
+
 	/*
 	============================================================================================
 		Constructors / Destructor
@@ -78,14 +100,37 @@ class StreamdeckServer : private QTcpServer {
 		void
 		incomingConnection(qintptr socket_descriptor) override final;
 
+		StreamdeckReactor*
+		nextReactor() const;
+
 	public:
 
 		StreamdeckClient*
 		nextPendingClient();
 
+	/*
+	============================================================================================
+		Slots
+	============================================================================================
+	*/
+	private slots:
+
+		void
+		onClientOpened(StreamdeckClient* client, bool success);
+
+	/*
+	============================================================================================
+		Signals
+	============================================================================================
+	*/
+	signals:
+
+		void
+		clientReady();
+
 };
 
-class StreamdeckManager : public QObject, public SafeEventObservable<rpc::event> {
+class StreamdeckManager : public QObject, public EventObservable<rpc::event> {
 	
 	Q_OBJECT
 
@@ -100,6 +145,22 @@ class StreamdeckManager : public QObject, public SafeEventObservable<rpc::event>
 
 		QSet<Streamdeck*> m_streamdecks;
 
+		std::bitset<(size_t)rpc::event::COUNT> m_coalescedEvents;
+
+		QTimer m_coalescingTimer;
+
+		int m_coalescingWindow;
+
+		uint64_t m_eventsIn;
+
+		uint64_t m_eventsOut;
+
+		std::map<CacheKey, CachedResponse> m_responseCache;
+
+		uint64_t m_cacheHits;
+
+		uint64_t m_cacheMisses;
+
 	/*
 	====================================================================================================
 		Constructors / Destructor
@@ -121,6 +182,21 @@ class StreamdeckManager : public QObject, public SafeEventObservable<rpc::event>
 		void
 		listen(short listen_port = OBS_PORT);
 
+		void
+		setCoalescingWindow(int window_ms);
+
+		uint64_t
+		eventsIn() const;
+
+		uint64_t
+		eventsOut() const;
+
+		uint64_t
+		cacheHits() const;
+
+		uint64_t
+		cacheMisses() const;
+
 		template<typename T>
 		bool
 		commit_to(
@@ -135,6 +211,32 @@ class StreamdeckManager : public QObject, public SafeEventObservable<rpc::event>
 			bool(StreamdeckManager::*functor)(Streamdeck*, const rpc::response<T>&)
 		);
 
+		template<typename T>
+		bool
+		commit_all(
+			rpc::response<T>& response,
+			bool(StreamdeckManager::*renderer)(const rpc::response<T>&, rpc::frame&)
+		);
+
+		template<typename T, typename Loader>
+		bool
+		commit_cached(
+			rpc::response<T>& response,
+			bool(StreamdeckManager::*renderer)(const rpc::response<T>&, rpc::frame&),
+			uint16_t key,
+			uint64_t version,
+			Loader loader
+		);
+
+		bool
+		commit_coalesced(rpc::response<void>& response);
+
+		bool
+		commit_deltas(const Collection* collection, Streamdeck* streamdeck = nullptr);
+
+		bool
+		subscribed(std::initializer_list<rpc::event> events) const;
+
 		template<typename T>
 		bool
 		commit_any(
@@ -185,6 +287,28 @@ class StreamdeckManager : public QObject, public SafeEventObservable<rpc::event>
 
 		bool
 		setSources(Streamdeck* client, const rpc::response<Sources>& response);
+
+		bool
+		setDeltaSubscription(Streamdeck* client, const rpc::response<CollectionPtr>& response);
+
+		bool
+		setRevision(Streamdeck* client, const rpc::response<Revision>& response);
+
+		template<typename T>
+		bool
+		renderEvent(const rpc::response<T>& response, rpc::frame& frame);
+
+		bool
+		renderCollections(const rpc::response<Collections>& response, rpc::frame& frame);
+
+		bool
+		renderScenes(const rpc::response<Scenes>& response, rpc::frame& frame);
+
+		bool
+		renderSources(const rpc::response<Sources>& response, rpc::frame& frame);
+
+		bool
+		renderSchema(const rpc::response<Collections>& response, rpc::frame& frame);
 		
 	private:
 
@@ -207,6 +331,9 @@ class StreamdeckManager : public QObject, public SafeEventObservable<rpc::event>
 		void
 		onClientDisconnected(Streamdeck* streamdeck, int code);
 
+		void
+		onCoalescingTimeout();
+
 		void
 		receiveMessage(
 			Streamdeck* streamdeck,
@@ -11,6 +11,7 @@
  */
 #include "include/services/Service.hpp"
 #include "include/events/EventTrigger.hpp"
+#include "include/events/SignalQueue.hpp"
 #include "include/obs/OBSEvents.hpp"
 
 /*
@@ -33,6 +34,8 @@ class FrontendEventTrigger : public EventTrigger<FrontendEventTrigger, obs::fron
 			Service::_obs_started |= (event == OBS_FRONTEND_EVENT_FINISHED_LOADING);
 
 			if(Service::_obs_started) {
+				// Signals raised before this event are handled first
+				SignalQueue::drain();
 				notify(trigger, static_cast<obs::frontend::event>(event));
 			}
 		}
@@ -1,5 +1,11 @@
 #pragma once
 
+/*
+ * Boost Includes
+ */
+#include <boost/function.hpp>
+#include <boost/bind.hpp>
+
 /*
  * OBS Includes
  */
@@ -10,6 +16,7 @@
  * Plugin Includes
  */
 #include "include/events/EventTrigger.hpp"
+#include "include/events/SignalQueue.hpp"
 #include "include/services/Service.hpp"
 #include "include/obs/OBSEvents.hpp"
 
@@ -50,6 +57,19 @@ class OutputEventTrigger : public EventTrigger<OutputEventTrigger, obs::output::
 			func(data_output);
 		}
 
+		static void
+		DispatchSignal(SignalRecord& record, bool deliver) {
+			auto trigger_ref = reinterpret_cast<OutputEventTrigger*>(record.trigger);
+			obs_output_t* output = reinterpret_cast<obs_output_t*>(record.reference);
+
+			if(deliver) {
+				obs::output::event event = static_cast<obs::output::event>(record.event);
+				trigger_ref->notifyState(event, output, record.value.state);
+			}
+
+			obs_output_release(output);
+		}
+
 	/*
 	====================================================================================================
 		Instance Data Members
@@ -132,6 +152,22 @@ class OutputEventTrigger : public EventTrigger<OutputEventTrigger, obs::output::
 	private:
 
 		void outputState(obs::output::event event, obs_output_t* output, const char* state) {
+			if(output == nullptr) return;
+
+			// Kept alive until the state is dispatched on the model thread
+			obs_output_addref(output);
+
+			SignalRecord record;
+			record.dispatch = OutputEventTrigger::DispatchSignal;
+			record.trigger = this;
+			record.event = static_cast<int>(event);
+			record.object = output;
+			record.reference = output;
+			record.value.state = state;
+			SignalQueue::post(std::move(record));
+		}
+
+		void notifyState(obs::output::event event, obs_output_t* output, const char* state) {
 			if(m_outputs.find(output) == m_outputs.end()) return;
 			obs::output::data obs_output_data = obs::output::data{ event, output, state };
 
@@ -11,6 +11,7 @@
  */
 #include "include/services/Service.hpp"
 #include "include/events/EventTrigger.hpp"
+#include "include/events/SignalQueue.hpp"
 #include "include/obs/OBSEvents.hpp"
 
 /*
@@ -37,10 +38,7 @@ class SceneEventTrigger : public EventTrigger<SceneEventTrigger, obs::scene::eve
 				calldata_get_ptr(data, "source", &source) &&
 				strcmp(obs_source_get_id(source), "scene") == 0
 			) {
-				auto trigger_ref = reinterpret_cast<SceneEventTrigger*>(trigger);
-				obs::scene::data data = obs::scene::data { obs::scene::event::ADDED, nullptr };
-				data.obs_source = source;
-				trigger_ref->m_event.notifyEvent<const obs::scene::data&>(data.event, data);
+				SignalQueue::post(Record(trigger, obs::scene::event::ADDED, source));
 			}
 		}
 
@@ -53,15 +51,7 @@ class SceneEventTrigger : public EventTrigger<SceneEventTrigger, obs::scene::eve
 				calldata_get_ptr(data, "source", &source) &&
 				strcmp(obs_source_get_id(source), "scene") == 0
 			) {
-				auto trigger_ref = reinterpret_cast<SceneEventTrigger*>(trigger);
-				auto scene_it = trigger_ref->m_scenes.find(source);
-				if(scene_it != trigger_ref->m_scenes.end()) {
-					obs::scene::data data = obs::scene::data{
-						obs::scene::event::REMOVED,
-						scene_it->second
-					};
-					trigger_ref->m_event.notifyEvent<const obs::scene::data&>(data.event, data);
-				}
+				SignalQueue::post(Record(trigger, obs::scene::event::REMOVED, source));
 			}
 		}
 
@@ -70,21 +60,59 @@ class SceneEventTrigger : public EventTrigger<SceneEventTrigger, obs::scene::eve
 			if(!Service::_obs_started) return;
 
 			obs_source_t* source = nullptr;
+			const char* name = nullptr;
 			if(
 				calldata_get_ptr(data, "source", &source) &&
 				strcmp(obs_source_get_id(source), "scene") == 0
 			) {
-				auto trigger_ref = reinterpret_cast<SceneEventTrigger*>(trigger);
-				auto scene_it = trigger_ref->m_scenes.find(source);
-				if(scene_it != trigger_ref->m_scenes.end()) {
-					obs::scene::data ev_data = obs::scene::data{
-						obs::scene::event::RENAMED,
-						scene_it->second
-					};
-					calldata_get_string(data, "new_name", &ev_data.name);
-					trigger_ref->m_event.notifyEvent<const obs::scene::data&>(ev_data.event, ev_data);
+				SignalRecord record = Record(trigger, obs::scene::event::RENAMED, source);
+				if(calldata_get_string(data, "new_name", &name) && name != nullptr)
+					record.string = name;
+				SignalQueue::post(std::move(record));
+			}
+		}
+
+		static void
+		DispatchSignal(SignalRecord& record, bool deliver) {
+			auto trigger_ref = reinterpret_cast<SceneEventTrigger*>(record.trigger);
+			obs_source_t* reference = reinterpret_cast<obs_source_t*>(record.reference);
+
+			// Scenes are only followed from source_remove, a source without reference is gone already
+			if(deliver && reference != nullptr) {
+				obs::scene::data data = obs::scene::data{
+					static_cast<obs::scene::event>(record.event),
+					nullptr
+				};
+
+				if(data.event == obs::scene::event::ADDED) {
+					data.obs_source = reference;
+					trigger_ref->m_event.notifyEvent<const obs::scene::data&>(data.event, data);
+				}
+				else {
+					auto scene_it = trigger_ref->m_scenes.find(reference);
+					if(scene_it != trigger_ref->m_scenes.end()) {
+						data.scene = scene_it->second;
+						if(data.event == obs::scene::event::RENAMED)
+							data.name = record.string.c_str();
+						trigger_ref->m_event.notifyEvent<const obs::scene::data&>(data.event, data);
+					}
 				}
 			}
+
+			if(reference != nullptr)
+				obs_source_release(reference);
+		}
+
+		static SignalRecord
+		Record(void* trigger, obs::scene::event event, obs_source_t* source) {
+			SignalRecord record;
+			record.dispatch = SceneEventTrigger::DispatchSignal;
+			record.trigger = trigger;
+			record.event = static_cast<int>(event);
+			record.object = source;
+			record.reference = SignalQueue::retain(source);
+			record.value.int_value = 0;
+			return record;
 		}
 
 	/*
@@ -10,15 +10,38 @@
  * Plugin Includes
  */
 #include "include/events/EventTrigger.hpp"
+#include "include/events/SignalQueue.hpp"
 #include "include/services/Service.hpp"
+#include "include/obs/Collection.hpp"
 #include "include/obs/OBSEvents.hpp"
 
+/*
+========================================================================================================
+	Defines
+========================================================================================================
+*/
+
+// Queued scene renames, kept out of the range of obs::item::event
+#define SCENE_ITEM_TRIGGER_RENAME -1
+
 /*
 ========================================================================================================
 	Types Definitions
 ========================================================================================================
 */
 
+// Registered objects are only resolved when a signal is dispatched, a removed one is then ignored
+typedef struct SceneReference {
+	obs_source_t* source;
+	Collection* collection;
+	Handle<Scene> scene;
+} SceneReference;
+
+typedef struct ItemReference {
+	Collection* collection;
+	Handle<Item> item;
+} ItemReference;
+
 class SceneItemEventTrigger :
 	public EventTrigger<SceneItemEventTrigger, obs::item::event>
 #ifdef USE_SCENE_BY_FRONTEND
@@ -44,10 +67,9 @@ class SceneItemEventTrigger :
 				calldata_get_ptr(data, "source", &source) &&
 				calldata_get_string(data, "new_name", &name)
 			) {
-				obs_scene_t* scene = obs_scene_from_source(source);
-	
-				SceneItemEventTrigger& trigger_ref = *reinterpret_cast<SceneItemEventTrigger*>(trigger);
-				trigger_ref.triggerRenamedScene(scene, name);
+				SignalRecord record = Record(trigger, SCENE_ITEM_TRIGGER_RENAME, obs_scene_from_source(source));
+				record.string = name;
+				SignalQueue::post(std::move(record));
 			}
 		}
 #endif
@@ -64,8 +86,7 @@ class SceneItemEventTrigger :
 
 			if(!result) return;
 
-			SceneItemEventTrigger& trigger_ref = *reinterpret_cast<SceneItemEventTrigger*>(trigger);
-			trigger_ref.triggerAddedItem(scene, item);
+			SignalQueue::post(Record(trigger, obs::item::event::ADDED, scene, item));
 		}
 
 		static void
@@ -80,14 +101,16 @@ class SceneItemEventTrigger :
 
 			if(!result) return;
 
-			SceneItemEventTrigger& trigger_ref = *reinterpret_cast<SceneItemEventTrigger*>(trigger);
-			trigger_ref.triggerRemovedItem(scene, item);
+			SignalQueue::post(Record(trigger, obs::item::event::REMOVED, scene, item));
 		}
 
 		static void
 		OnItemVisibilityChanged(void* trigger, calldata_t* data) {
 			if(!Service::_obs_started) return;
 
+			// Changes applied by a visibility batch are notified once by its caller
+			if(Scene::ApplyingBatch()) return;
+
 			obs_scene_t* scene = nullptr;
 			obs_sceneitem_t* item = nullptr;
 			bool visible = false;
@@ -98,8 +121,8 @@ class SceneItemEventTrigger :
 
 			if(!result) return;
 
-			SceneItemEventTrigger& trigger_ref = *reinterpret_cast<SceneItemEventTrigger*>(trigger);
-			trigger_ref.triggerChangedItem(scene, item, visible);
+			obs::item::event event = visible ? obs::item::event::SHOWN : obs::item::event::HIDDEN;
+			SignalQueue::post(Record(trigger, event, scene, item));
 		}
 
 		static void
@@ -111,8 +134,67 @@ class SceneItemEventTrigger :
 
 			if(!result) return;
 
-			SceneItemEventTrigger& trigger_ref = *reinterpret_cast<SceneItemEventTrigger*>(trigger);
-			trigger_ref.triggerReorderedItems(scene);
+			SignalQueue::post(Record(trigger, obs::item::event::REORDER, scene));
+		}
+
+		static void
+		DispatchSignal(SignalRecord& record, bool deliver) {
+			SceneItemEventTrigger& trigger_ref = *reinterpret_cast<SceneItemEventTrigger*>(record.trigger);
+			obs_scene_t* scene = reinterpret_cast<obs_scene_t*>(record.object);
+			obs_sceneitem_t* item = reinterpret_cast<obs_sceneitem_t*>(record.reference);
+
+			if(deliver) {
+				switch(record.event) {
+#ifdef USE_SCENE_BY_FRONTEND
+					case SCENE_ITEM_TRIGGER_RENAME:
+						trigger_ref.triggerRenamedScene(scene, record.string.c_str());
+						break;
+#endif
+					case static_cast<int>(obs::item::event::ADDED):
+						trigger_ref.triggerAddedItem(scene, item);
+						break;
+					case static_cast<int>(obs::item::event::REMOVED):
+						trigger_ref.triggerRemovedItem(scene, item);
+						break;
+					case static_cast<int>(obs::item::event::SHOWN):
+						trigger_ref.triggerChangedItem(scene, item, true);
+						break;
+					case static_cast<int>(obs::item::event::HIDDEN):
+						trigger_ref.triggerChangedItem(scene, item, false);
+						break;
+					case static_cast<int>(obs::item::event::REORDER):
+						trigger_ref.triggerReorderedItems(scene);
+						break;
+				}
+			}
+
+			if(item != nullptr)
+				obs_sceneitem_release(item);
+			if(scene != nullptr)
+				obs_scene_release(scene);
+		}
+
+		static SignalRecord
+		Record(void* trigger, int event, obs_scene_t* scene, obs_sceneitem_t* item = nullptr) {
+			// Both stay alive until the record is dispatched
+			if(scene != nullptr)
+				obs_scene_addref(scene);
+			if(item != nullptr)
+				obs_sceneitem_addref(item);
+
+			SignalRecord record;
+			record.dispatch = SceneItemEventTrigger::DispatchSignal;
+			record.trigger = trigger;
+			record.event = event;
+			record.object = scene;
+			record.reference = item;
+			record.value.int_value = 0;
+			return record;
+		}
+
+		static SignalRecord
+		Record(void* trigger, obs::item::event event, obs_scene_t* scene, obs_sceneitem_t* item = nullptr) {
+			return Record(trigger, static_cast<int>(event), scene, item);
 		}
 
 	/*
@@ -121,9 +203,9 @@ class SceneItemEventTrigger :
 	====================================================================================================
 	*/
 	private:
-		std::map<obs_scene_t*, Scene*> m_scenes;
+		std::map<obs_scene_t*, SceneReference> m_scenes;
 
-		std::map<obs_sceneitem_t*, Item*> m_items;
+		std::map<obs_sceneitem_t*, ItemReference> m_items;
 
 	/*
 	====================================================================================================
@@ -150,12 +232,12 @@ class SceneItemEventTrigger :
 #ifdef USE_SCENE_BY_FRONTEND
 		void
 		triggerRenamedScene(obs_scene_t* scene, const char* name) {
-			auto iter = m_scenes.find(scene);
-			if(iter == m_scenes.end()) return;
+			Scene* scene_ref = resolveScene(scene);
+			if(scene_ref == nullptr) return;
 
-			if(iter->second->name().compare(name) == 0) return;
+			if(scene_ref->name().compare(name) == 0) return;
 
-			UnsafeEventObservable<obs::frontend::event>& event_ref =
+			EventObservable<obs::frontend::event>& event_ref =
 				EventTrigger<SceneItemEventTrigger, obs::frontend::event>::m_event;
 			event_ref.notifyEvent(obs::frontend::event::SCENE_LIST_CHANGED);
 		}
@@ -163,14 +245,14 @@ class SceneItemEventTrigger :
 
 		void
 		triggerAddedItem(obs_scene_t* scene, obs_sceneitem_t* item) {
-			auto iter = m_scenes.find(scene);
-			if(iter == m_scenes.end()) return;
+			Scene* scene_ref = resolveScene(scene);
+			if(scene_ref == nullptr) return;
 
-			obs::item::data data = { obs::item::event::ADDED, iter->second };
+			obs::item::data data = { obs::item::event::ADDED, scene_ref };
 			data.sceneitem = item;
 
 #ifdef USE_SCENE_BY_FRONTEND
-			UnsafeEventObservable<obs::item::event>& event_ref =
+			EventObservable<obs::item::event>& event_ref =
 				EventTrigger<SceneItemEventTrigger, obs::item::event>::m_event;
 			event_ref.notifyEvent<const obs::item::data&>(obs::item::event::ADDED, data);
 #else
@@ -180,17 +262,17 @@ class SceneItemEventTrigger :
 
 		void
 		triggerRemovedItem(obs_scene_t* scene, obs_sceneitem_t* item) {
-			auto scene_ref = m_scenes.find(scene);
-			if(scene_ref == m_scenes.end()) return;
+			Scene* scene_ref = resolveScene(scene);
+			if(scene_ref == nullptr) return;
 
-			auto item_ref = m_items.find(item);
-			if(item_ref == m_items.end()) return;
+			Item* item_ref = resolveItem(item);
+			if(item_ref == nullptr) return;
 
-			obs::item::data data = { obs::item::event::REMOVED, scene_ref->second };
-			data.item = const_cast<Item*>(item_ref->second);
+			obs::item::data data = { obs::item::event::REMOVED, scene_ref };
+			data.item = item_ref;
 
 #ifdef USE_SCENE_BY_FRONTEND
-			UnsafeEventObservable<obs::item::event>& event_ref =
+			EventObservable<obs::item::event>& event_ref =
 				EventTrigger<SceneItemEventTrigger, obs::item::event>::m_event;
 			event_ref.notifyEvent<const obs::item::data&>(obs::item::event::REMOVED, data);
 #else
@@ -200,19 +282,19 @@ class SceneItemEventTrigger :
 
 		void
 		triggerChangedItem(obs_scene_t* scene, obs_sceneitem_t* item, bool visible) {
-			auto scene_ref = m_scenes.find(scene);
-			if(scene_ref == m_scenes.end()) return;
+			Scene* scene_ref = resolveScene(scene);
+			if(scene_ref == nullptr) return;
 
-			auto item_ref = m_items.find(item);
-			if(item_ref == m_items.end()) return;
+			Item* item_ref = resolveItem(item);
+			if(item_ref == nullptr) return;
 
 			obs::item::event event = visible ? obs::item::event::SHOWN : obs::item::event::HIDDEN;
 
-			obs::item::data data = { event , scene_ref->second };
-			data.item = item_ref->second;
+			obs::item::data data = { event , scene_ref };
+			data.item = item_ref;
 
 #ifdef USE_SCENE_BY_FRONTEND
-			UnsafeEventObservable<obs::item::event>& event_ref =
+			EventObservable<obs::item::event>& event_ref =
 				EventTrigger<SceneItemEventTrigger, obs::item::event>::m_event;
 			event_ref.notifyEvent<const obs::item::data&>(event, data);
 #else
@@ -222,10 +304,10 @@ class SceneItemEventTrigger :
 
 		void
 		triggerReorderedItems(obs_scene_t* scene) {
-			auto scene_ref = m_scenes.find(scene);
-			if(scene_ref == m_scenes.end()) return;
+			Scene* scene_ref = resolveScene(scene);
+			if(scene_ref == nullptr) return;
 
-			obs::item::data data = { obs::item::event::REORDER , scene_ref->second };
+			obs::item::data data = { obs::item::event::REORDER , scene_ref };
 
 			m_event.notifyEvent<const obs::item::data&>(obs::item::event::REORDER, data);
 		}
@@ -233,7 +315,8 @@ class SceneItemEventTrigger :
 		void
 		addItem(const Item* item) {
 			if(m_items.find(item->item()) == m_items.end()) {
-				m_items.insert(std::make_pair(item->item(), const_cast<Item*>(item)));
+				ItemReference reference = { item->scene()->collection(), item->handle() };
+				m_items.insert(std::make_pair(item->item(), reference));
 			}
 		}
 
@@ -280,7 +363,8 @@ class SceneItemEventTrigger :
 						this
 					);
 
-					m_scenes.insert(std::make_pair(scene->scene(), const_cast<Scene*>(scene)));
+					SceneReference reference = { scene->source(), scene->collection(), scene->handle() };
+					m_scenes.insert(std::make_pair(scene->scene(), reference));
 				}
 			}
 		}
@@ -297,11 +381,10 @@ class SceneItemEventTrigger :
 		}
 
 		void
-		removeScene(std::map<obs_scene_t*, Scene*>::iterator scene) {
+		removeScene(std::map<obs_scene_t*, SceneReference>::iterator scene) {
 			if(scene != m_scenes.end()) {
-				signal_handler_t* signal_handler = obs_source_get_signal_handler(
-					scene->second->source()
-				);
+				// The scene may be gone from the model, its OBS source was kept for that purpose
+				signal_handler_t* signal_handler = obs_source_get_signal_handler(scene->second.source);
 				if(signal_handler != nullptr) {
 
 #ifdef USE_SCENE_BY_FRONTEND
@@ -356,4 +439,20 @@ class SceneItemEventTrigger :
 			auto iter = m_items.find(item);
 			if(iter != m_items.end()) m_items.erase(iter);
 		}
+
+	private:
+
+		Scene*
+		resolveScene(obs_scene_t* scene) const {
+			auto iter = m_scenes.find(scene);
+			if(iter == m_scenes.end()) return nullptr;
+			return iter->second.collection->resolve(iter->second.scene);
+		}
+
+		Item*
+		resolveItem(obs_sceneitem_t* item) const {
+			auto iter = m_items.find(item);
+			if(iter == m_items.end()) return nullptr;
+			return iter->second.collection->resolve(iter->second.item);
+		}
 };
\ No newline at end of file
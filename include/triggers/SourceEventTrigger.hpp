@@ -11,6 +11,8 @@
  */
 #include "include/services/Service.hpp"
 #include "include/events/EventTrigger.hpp"
+#include "include/events/SignalQueue.hpp"
+#include "include/events/SignalRegistry.hpp"
 #include "include/obs/OBSEvents.hpp"
 
 /*
@@ -33,11 +35,8 @@ class SourceEventTrigger : public EventTrigger<SourceEventTrigger, obs::source::
 			if(!Service::_obs_started) return;
 
 			obs_source_t* source = nullptr;
-			if(calldata_get_ptr(data, "source", &source)) {
-				obs::source::data event_data = obs::source::data{ obs::source::event::ADDED, nullptr };
-				event_data.data.obs_source = source;
-				notify<const obs::source::data&>(trigger, obs::source::event::ADDED, event_data);
-			}
+			if(calldata_get_ptr(data, "source", &source))
+				SignalQueue::post(Record(trigger, obs::source::event::ADDED, source));
 		}
 
 		static void
@@ -47,30 +46,59 @@ class SourceEventTrigger : public EventTrigger<SourceEventTrigger, obs::source::
 			obs_source_t* source = nullptr;
 			if(calldata_get_ptr(data, "source", &source)) {
 				auto trigger_typed = reinterpret_cast<SourceEventTrigger*>(trigger);
-				auto source_it = trigger_typed->m_sources.find(source);
-				if(source_it != trigger_typed->m_sources.end()) {
-					obs::source::data event_data = obs::source::data{
-						obs::source::event::REMOVED,
-						source_it->second
-					};
-					trigger_typed->m_event.notifyEvent<const obs::source::data&>(
-						obs::source::event::REMOVED,
-						event_data
-					);
+
+				// The source is about to be freed, handle it while it is still valid if possible
+				if(SignalQueue::onModelThread()) {
+					SignalQueue::drain();
+					trigger_typed->removed(source, source);
+				}
+				else {
+					SignalQueue::post(Record(trigger, obs::source::event::REMOVED, source));
 				}
 			}
 		}
 
 		static void
-		Call(void* callback, calldata_t* data) {
-			if(!Service::_obs_started) return;
-
-			obs_source_t* source = nullptr;
-			if(calldata_get_ptr(data, "source", &source)) {
-				typedef boost::function<void(obs_source_t*, calldata_t*)> func;
-				func function = *reinterpret_cast<func*>(callback);
-				function(source, data);
+		DispatchSignal(SignalRecord& record, bool deliver) {
+			auto trigger_typed = reinterpret_cast<SourceEventTrigger*>(record.trigger);
+			obs_source_t* source = reinterpret_cast<obs_source_t*>(record.object);
+			obs_source_t* reference = reinterpret_cast<obs_source_t*>(record.reference);
+
+			if(deliver) {
+				obs::source::event event = static_cast<obs::source::event>(record.event);
+				switch(event) {
+					case obs::source::event::ADDED:
+						if(reference != nullptr) {
+							obs::source::data event_data = obs::source::data{ event, nullptr };
+							event_data.data.obs_source = reference;
+							trigger_typed->m_event.notifyEvent<const obs::source::data&>(event, event_data);
+						}
+						break;
+
+					case obs::source::event::REMOVED:
+						trigger_typed->removed(source, reference);
+						break;
+
+					default:
+						trigger_typed->changed(source, record);
+						break;
+				}
 			}
+
+			if(reference != nullptr)
+				obs_source_release(reference);
+		}
+
+		static SignalRecord
+		Record(void* trigger, obs::source::event event, obs_source_t* source) {
+			SignalRecord record;
+			record.dispatch = SourceEventTrigger::DispatchSignal;
+			record.trigger = trigger;
+			record.event = static_cast<int>(event);
+			record.object = source;
+			record.reference = SignalQueue::retain(source);
+			record.value.int_value = 0;
+			return record;
 		}
 
 	/*
@@ -80,7 +108,7 @@ class SourceEventTrigger : public EventTrigger<SourceEventTrigger, obs::source::
 	*/
 	private:
 
-		std::map<const char*, boost::function<void(obs_source_t*, calldata_t*)>> m_callbacks;
+		SignalRegistry<SourceEventTrigger, 3> m_callbacks;
 
 		std::map<obs_source_t*, Source*> m_sources;
 
@@ -161,16 +189,8 @@ class SourceEventTrigger : public EventTrigger<SourceEventTrigger, obs::source::
 		addSource(const Source* source) {
 			if(m_sources.find(source->source()) == m_sources.end()) {
 				signal_handler_t* signal_handler = obs_source_get_signal_handler(source->source());
-				if(signal_handler != nullptr) {
-					for(auto cb_iter = m_callbacks.begin(); cb_iter != m_callbacks.end(); cb_iter++) {
-						signal_handler_connect(
-							signal_handler,
-							cb_iter->first,
-							SourceEventTrigger::Call,
-							&cb_iter->second
-						);
-					}
-				}
+				if(signal_handler != nullptr)
+					m_callbacks.connect(signal_handler);
 				m_sources.insert(std::make_pair(source->source(), const_cast<Source*>(source)));
 			}
 		}
@@ -179,16 +199,8 @@ class SourceEventTrigger : public EventTrigger<SourceEventTrigger, obs::source::
 		removeSource(std::map<obs_source_t*, Source*>::iterator source) {
 			if(source != m_sources.end()) {
 				signal_handler_t* signal_handler = obs_source_get_signal_handler(source->first);
-				if(signal_handler != nullptr) {
-					for(auto cb_iter = m_callbacks.begin(); cb_iter != m_callbacks.end(); cb_iter++) {
-						signal_handler_disconnect(
-							signal_handler,
-							cb_iter->first,
-							SourceEventTrigger::Call,
-							&cb_iter->second
-						);
-					}
-				}
+				if(signal_handler != nullptr)
+					m_callbacks.disconnect(signal_handler);
 				m_sources.erase(source);
 			}
 		}
@@ -211,51 +223,100 @@ class SourceEventTrigger : public EventTrigger<SourceEventTrigger, obs::source::
 
 		void
 		registerCallbacks() {
-			m_callbacks["mute"] = boost::bind(&SourceEventTrigger::onMute, this, _1, _2);
-			m_callbacks["update_flags"] = boost::bind(&SourceEventTrigger::onFlags, this, _1, _2);
-			m_callbacks["rename"] = boost::bind(&SourceEventTrigger::onRename, this, _1, _2);
+			m_callbacks.add("mute", this, &SourceEventTrigger::onMute);
+			m_callbacks.add("update_flags", this, &SourceEventTrigger::onFlags);
+			m_callbacks.add("rename", this, &SourceEventTrigger::onRename);
+		}
+
+		obs_source_t*
+		signalSource(calldata_t* data_ptr) const {
+			obs_source_t* obs_source = nullptr;
+			if(!Service::_obs_started || !calldata_get_ptr(data_ptr, "source", &obs_source))
+				return nullptr;
+			return obs_source;
 		}
 
 		void
-		onMute(obs_source_t* obs_source, calldata_t* data_ptr) {
-			auto source = m_sources.find(obs_source);
-			if(source != m_sources.end()) {
-				obs::source::data data = obs::source::data{
-					obs::source::event::MUTE,
-					source->second
-				};
-				if(calldata_get_bool(data_ptr, "muted", &data.data.boolean_value)) {
-					m_event.notifyEvent<const obs::source::data&>(data.event, data);
-				}
+		onMute(calldata_t* data_ptr) {
+			obs_source_t* obs_source = signalSource(data_ptr);
+			if(obs_source == nullptr) return;
+
+			bool muted = false;
+			if(calldata_get_bool(data_ptr, "muted", &muted)) {
+				SignalRecord record = Record(this, obs::source::event::MUTE, obs_source);
+				record.value.boolean_value = muted;
+				SignalQueue::post(std::move(record));
 			}
 		}
 
 		void
-		onFlags(obs_source_t* obs_source, calldata_t* data_ptr) {
-			auto source = m_sources.find(obs_source);
-			if(source != m_sources.end()) {
-				obs::source::data data = obs::source::data{
-					obs::source::event::FLAGS,
-					source->second
-				};
-				if(calldata_get_int(data_ptr, "flags", &data.data.uint_value)) {
-					m_event.notifyEvent<const obs::source::data&>(data.event, data);
-				}
+		onFlags(calldata_t* data_ptr) {
+			obs_source_t* obs_source = signalSource(data_ptr);
+			if(obs_source == nullptr) return;
+
+			long long flags = 0;
+			if(calldata_get_int(data_ptr, "flags", &flags)) {
+				SignalRecord record = Record(this, obs::source::event::FLAGS, obs_source);
+				record.value.int_value = flags;
+				SignalQueue::post(std::move(record));
 			}
 		}
 
 		void
-		onRename(obs_source_t* obs_source, calldata_t* data_ptr) {
+		onRename(calldata_t* data_ptr) {
+			obs_source_t* obs_source = signalSource(data_ptr);
+			if(obs_source == nullptr) return;
+
+			const char* name = nullptr;
+			if(calldata_get_string(data_ptr, "new_name", &name) && name != nullptr) {
+				SignalRecord record = Record(this, obs::source::event::RENAMED, obs_source);
+				record.string = name;
+				SignalQueue::post(std::move(record));
+			}
+		}
+
+		void
+		removed(obs_source_t* obs_source, obs_source_t* reference) {
+			auto source_it = m_sources.find(obs_source);
+			if(source_it == m_sources.end()) return;
+
+			obs::source::data event_data = obs::source::data{
+				obs::source::event::REMOVED,
+				source_it->second
+			};
+
+			// Already destroyed, its signal handler went with it and must not be disconnected
+			if(reference == nullptr)
+				m_sources.erase(source_it);
+
+			m_event.notifyEvent<const obs::source::data&>(obs::source::event::REMOVED, event_data);
+		}
+
+		void
+		changed(obs_source_t* obs_source, const SignalRecord& record) {
+			if(record.reference == nullptr) return;
+
 			auto source = m_sources.find(obs_source);
-			if(source != m_sources.end()) {
-				obs::source::data data = obs::source::data{
-					obs::source::event::RENAMED,
-					source->second
-				};
-				if(calldata_get_string(data_ptr, "new_name", &data.data.string_value)) {
-					m_event.notifyEvent<const obs::source::data&>(data.event, data);
-				}
+			if(source == m_sources.end()) return;
+
+			obs::source::data data = obs::source::data{
+				static_cast<obs::source::event>(record.event),
+				source->second
+			};
+			switch(data.event) {
+				case obs::source::event::MUTE:
+					data.data.boolean_value = record.value.boolean_value;
+					break;
+				case obs::source::event::FLAGS:
+					data.data.uint_value = record.value.int_value;
+					break;
+				case obs::source::event::RENAMED:
+					data.data.string_value = record.string.c_str();
+					break;
+				default:
+					return;
 			}
+			m_event.notifyEvent<const obs::source::data&>(data.event, data);
 		}
 
 };
\ No newline at end of file
@@ -0,0 +1,107 @@
+/*
+ * Std Includes
+ */
+#include <algorithm>
+#include <new>
+
+/*
+ * Plugin Includes
+ */
+#include "include/common/Arena.hpp"
+
+/*
+========================================================================================================
+	Constructors / Destructor
+========================================================================================================
+*/
+
+Arena::Arena() :
+	m_current(nullptr),
+	m_available(0),
+	m_allocations(0),
+	m_used(0) {
+}
+
+Arena::~Arena() {
+	for(auto iter = m_blocks.begin(); iter != m_blocks.end(); iter++)
+		::operator delete(*iter);
+}
+
+/*
+========================================================================================================
+	Allocation
+========================================================================================================
+*/
+
+void*
+Arena::allocate(size_t size) {
+	// Every chunk keeps the strictest alignment, and is large enough to link it once freed
+	const size_t alignment = alignof(std::max_align_t);
+	size = std::max(size, sizeof(void*));
+	size = (size + alignment - 1) & ~(alignment - 1);
+
+	m_allocations++;
+	m_used += size;
+
+	auto free_chunk = m_free.find(size);
+	if(free_chunk != m_free.end() && free_chunk->second != nullptr) {
+		void* chunk = free_chunk->second;
+		free_chunk->second = *reinterpret_cast<void**>(chunk);
+		return chunk;
+	}
+
+	// Oversized requests get their own block
+	if(size > ARENA_BLOCK_SIZE / 4) {
+		char* block = static_cast<char*>(::operator new(size));
+		m_blocks.push_back(block);
+		return block;
+	}
+
+	if(size > m_available) {
+		m_current = static_cast<char*>(::operator new(ARENA_BLOCK_SIZE));
+		m_available = ARENA_BLOCK_SIZE;
+		m_blocks.push_back(m_current);
+	}
+
+	void* chunk = m_current;
+	m_current += size;
+	m_available -= size;
+	return chunk;
+}
+
+void
+Arena::deallocate(void* pointer, size_t size) {
+	if(pointer == nullptr)
+		return;
+
+	const size_t alignment = alignof(std::max_align_t);
+	size = std::max(size, sizeof(void*));
+	size = (size + alignment - 1) & ~(alignment - 1);
+
+	m_used -= size;
+
+	void*& head = m_free[size];
+	*reinterpret_cast<void**>(pointer) = head;
+	head = pointer;
+}
+
+/*
+========================================================================================================
+	Accessors
+========================================================================================================
+*/
+
+size_t
+Arena::allocations() const {
+	return m_allocations;
+}
+
+size_t
+Arena::used() const {
+	return m_used;
+}
+
+size_t
+Arena::blocks() const {
+	return m_blocks.size();
+}
\ No newline at end of file
@@ -0,0 +1,231 @@
+/*
+ * Std Includes
+ */
+#include <algorithm>
+#include <cstring>
+
+/*
+ * Plugin Includes
+ */
+#include "include/common/Buffer.hpp"
+
+/*
+========================================================================================================
+	Constructors / Destructor
+========================================================================================================
+*/
+
+Buffer::Buffer() :
+	m_size(0),
+	m_capacity(0) {
+}
+
+Buffer::Buffer(size_t size) :
+	m_data(new byte[size]),
+	m_size(size),
+	m_capacity(size) {
+}
+
+Buffer::Buffer(Buffer&& buffer) noexcept :
+	m_data(std::move(buffer.m_data)),
+	m_size(buffer.m_size),
+	m_capacity(buffer.m_capacity) {
+	buffer.m_size = 0;
+	buffer.m_capacity = 0;
+}
+
+Buffer::~Buffer() {
+}
+
+/*
+========================================================================================================
+	Operators
+========================================================================================================
+*/
+
+Buffer&
+Buffer::operator=(Buffer&& buffer) noexcept {
+	m_data = std::move(buffer.m_data);
+	m_size = buffer.m_size;
+	m_capacity = buffer.m_capacity;
+	buffer.m_size = 0;
+	buffer.m_capacity = 0;
+	return *this;
+}
+
+/*
+========================================================================================================
+	Memory Handling
+========================================================================================================
+*/
+
+byte*
+Buffer::data() {
+	return m_data.get();
+}
+
+const byte*
+Buffer::data() const {
+	return m_data.get();
+}
+
+size_t
+Buffer::size() const {
+	return m_size;
+}
+
+size_t
+Buffer::capacity() const {
+	return m_capacity;
+}
+
+void
+Buffer::reserve(size_t capacity) {
+	if(capacity <= m_capacity)
+		return;
+
+	// The only copy a buffer makes, when it outgrows its block
+	std::unique_ptr<byte[]> data(new byte[capacity]);
+	if(m_size > 0)
+		memcpy(data.get(), m_data.get(), m_size);
+	m_data = std::move(data);
+	m_capacity = capacity;
+}
+
+void
+Buffer::resize(size_t size) {
+	if(size > m_capacity)
+		reserve(std::max<size_t>({ size, m_capacity * 2, BUFFER_MIN_CAPACITY }));
+	m_size = size;
+}
+
+void
+Buffer::clear() {
+	m_size = 0;
+}
+
+/*
+========================================================================================================
+	Writer
+========================================================================================================
+*/
+
+BufferWriter::BufferWriter(Buffer& buffer) :
+	m_buffer(buffer) {
+}
+
+BufferWriter::~BufferWriter() {
+}
+
+BufferWriter&
+BufferWriter::write(const byte* data, size_t size) {
+	if(size > 0)
+		memcpy(grow(size), data, size);
+	return *this;
+}
+
+BufferWriter&
+BufferWriter::write(const std::string& string) {
+	/*BLOCK
+		length (unsigned int)
+		string (length)
+	*/
+	write(static_cast<unsigned int>(string.size()));
+	return write(string.data(), string.size());
+}
+
+size_t
+BufferWriter::beginBlock() {
+	return reserve<size_t>();
+}
+
+void
+BufferWriter::endBlock(size_t offset) {
+	patch<size_t>(offset, m_buffer.size() - offset - sizeof(size_t));
+}
+
+size_t
+BufferWriter::position() const {
+	return m_buffer.size();
+}
+
+byte*
+BufferWriter::grow(size_t size) {
+	size_t offset = m_buffer.size();
+	m_buffer.resize(offset + size);
+	return m_buffer.data() + offset;
+}
+
+/*
+========================================================================================================
+	Reader
+========================================================================================================
+*/
+
+BufferReader::BufferReader(const byte* data, size_t size) :
+	m_data(data),
+	m_size(data != nullptr ? size : 0),
+	m_position(0),
+	m_failed(false) {
+}
+
+BufferReader::BufferReader(const Buffer& buffer) :
+	BufferReader(buffer.data(), buffer.size()) {
+}
+
+BufferReader::~BufferReader() {
+}
+
+bool
+BufferReader::read(byte* data, size_t size) {
+	const byte* bytes = take(size);
+	if(bytes == nullptr)
+		return false;
+
+	if(size > 0)
+		memcpy(data, bytes, size);
+	return true;
+}
+
+bool
+BufferReader::read(std::string& string) {
+	unsigned int length = 0;
+	return read(length) && read(string, length);
+}
+
+bool
+BufferReader::read(std::string& string, size_t size) {
+	const byte* bytes = take(size);
+	if(bytes == nullptr)
+		return false;
+
+	string.assign(bytes, size);
+	return true;
+}
+
+size_t
+BufferReader::position() const {
+	return m_position;
+}
+
+size_t
+BufferReader::remaining() const {
+	return m_size - m_position;
+}
+
+bool
+BufferReader::failed() const {
+	return m_failed;
+}
+
+const byte*
+BufferReader::take(size_t size) {
+	if(m_failed || size > m_size - m_position) {
+		m_failed = true;
+		return nullptr;
+	}
+
+	const byte* bytes = m_data + m_position;
+	m_position += size;
+	return bytes;
+}
\ No newline at end of file
@@ -0,0 +1,170 @@
+/*
+ * Std Includes
+ */
+#include <algorithm>
+
+/*
+ * Plugin Includes
+ */
+#include "include/common/NameTable.hpp"
+#include "include/rpc/RPCWriter.hpp"
+
+/*
+========================================================================================================
+	Name
+========================================================================================================
+*/
+
+Name::Name(const std::string& value) :
+	m_entry(std::make_shared<NameEntry>()) {
+	m_entry->id = 0;
+	m_entry->value = value;
+	m_entry->table = nullptr;
+	NameTable::Escape(m_entry.get());
+}
+
+Name::Name(const char* value) :
+	Name(std::string(value)) {
+}
+
+Name::Name(const std::shared_ptr<NameEntry>& entry) :
+	m_entry(entry) {
+}
+
+uint32_t
+Name::id() const {
+	return m_entry->id;
+}
+
+const std::string&
+Name::str() const {
+	return m_entry->value;
+}
+
+const std::string&
+Name::escaped() const {
+	return m_entry->escaped;
+}
+
+void
+Name::rename(const std::string& value) {
+	if(m_entry->table != nullptr) {
+		m_entry->table->rename(m_entry.get(), value);
+		return;
+	}
+
+	m_entry->value = value;
+	NameTable::Escape(m_entry.get());
+}
+
+bool
+Name::operator==(const Name& name) const {
+	return m_entry == name.m_entry || m_entry->value == name.m_entry->value;
+}
+
+bool
+Name::operator!=(const Name& name) const {
+	return !(*this == name);
+}
+
+/*
+========================================================================================================
+	Constructors / Destructor
+========================================================================================================
+*/
+
+NameTable::NameTable() :
+	m_lastId(0),
+	m_purgeThreshold(NAME_TABLE_MIN_PURGE) {
+}
+
+NameTable::~NameTable() {
+	// Names outliving the table keep their entry, renaming them no longer reaches the table
+	for(auto iter = m_entries.begin(); iter != m_entries.end(); iter++)
+		iter->second->table = nullptr;
+}
+
+/*
+========================================================================================================
+	Interning
+========================================================================================================
+*/
+
+Name
+NameTable::intern(std::string_view value) {
+	auto iter = m_entries.find(value);
+	if(iter != m_entries.end())
+		return Name(iter->second);
+
+	if(m_entries.size() >= m_purgeThreshold) {
+		purge();
+		m_purgeThreshold = std::max<size_t>(NAME_TABLE_MIN_PURGE, m_entries.size() * 2);
+	}
+
+	std::shared_ptr<NameEntry> entry = std::make_shared<NameEntry>();
+	entry->id = ++m_lastId;
+	entry->value = std::string(value);
+	entry->table = this;
+	Escape(entry.get());
+
+	m_entries.emplace(std::string_view(entry->value), entry);
+	return Name(entry);
+}
+
+size_t
+NameTable::size() const {
+	return m_entries.size();
+}
+
+size_t
+NameTable::purge() {
+	size_t purged = 0;
+	for(auto iter = m_entries.begin(); iter != m_entries.end();) {
+		// Only referenced by the table
+		if(iter->second.use_count() == 1) {
+			iter = m_entries.erase(iter);
+			purged++;
+		}
+		else
+			iter++;
+	}
+	return purged;
+}
+
+void
+NameTable::rename(NameEntry* entry, const std::string& value) {
+	std::shared_ptr<NameEntry> owner;
+	auto iter = m_entries.find(entry->value);
+	if(iter != m_entries.end() && iter->second.get() == entry) {
+		owner = iter->second;
+		m_entries.erase(iter);
+	}
+
+	entry->value = value;
+	Escape(entry);
+
+	if(owner == nullptr) {
+		entry->table = nullptr;
+		return;
+	}
+
+	// The renamed entry takes the name over, the entry previously interned keeps its holders
+	iter = m_entries.find(entry->value);
+	if(iter != m_entries.end()) {
+		iter->second->table = nullptr;
+		m_entries.erase(iter);
+	}
+	m_entries.emplace(std::string_view(entry->value), owner);
+}
+
+/*
+========================================================================================================
+	Helpers
+========================================================================================================
+*/
+
+void
+NameTable::Escape(NameEntry* entry) {
+	entry->escaped.clear();
+	rpc::json_writer<std::string>(entry->escaped).escaped(entry->value.data(), entry->value.size());
+}
\ No newline at end of file
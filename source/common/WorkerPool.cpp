@@ -0,0 +1,132 @@
+/*
+ * Std Includes
+ */
+#include <algorithm>
+
+/*
+ * Plugin Includes
+ */
+#include "include/common/WorkerPool.hpp"
+
+/*
+========================================================================================================
+	Constructors / Destructor
+========================================================================================================
+*/
+
+WorkerPool::WorkerPool(size_t workers) :
+	m_workers(workers),
+	m_task(nullptr),
+	m_count(0),
+	m_next(0),
+	m_batch(0),
+	m_active(0),
+	m_stopping(false),
+	m_error(nullptr) {
+	if(m_workers == 0)
+		m_workers = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+	m_workers = std::min<size_t>(m_workers, WORKER_POOL_MAX_SIZE);
+
+	// The calling thread is one of the workers of every batch
+	for(size_t i = 1; i < m_workers; i++)
+		m_threads.emplace_back(&WorkerPool::work, this);
+}
+
+WorkerPool::~WorkerPool() {
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		m_stopping = true;
+	}
+	m_wake.notify_all();
+
+	for(auto iter = m_threads.begin(); iter != m_threads.end(); iter++)
+		iter->join();
+}
+
+/*
+========================================================================================================
+	Accessors
+========================================================================================================
+*/
+
+size_t
+WorkerPool::workers() const {
+	return m_workers;
+}
+
+/*
+========================================================================================================
+	Execution
+========================================================================================================
+*/
+
+void
+WorkerPool::run(size_t count, const std::function<void(size_t)>& task) {
+	if(count == 0)
+		return;
+
+	std::lock_guard<std::mutex> batch(m_runLock);
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		m_task = &task;
+		m_count = count;
+		m_next.store(0, std::memory_order_relaxed);
+		m_error = nullptr;
+		m_active = m_threads.size();
+		m_batch++;
+	}
+	m_wake.notify_all();
+
+	drain(task, count);
+
+	std::exception_ptr error = nullptr;
+	{
+		// Every worker has to leave the batch before the task it points to goes out of scope
+		std::unique_lock<std::mutex> lock(m_lock);
+		m_done.wait(lock, [this]() { return m_active == 0; });
+		m_task = nullptr;
+		error = m_error;
+		m_error = nullptr;
+	}
+
+	if(error != nullptr)
+		std::rethrow_exception(error);
+}
+
+void
+WorkerPool::work() {
+	uint64_t batch = 0;
+	std::unique_lock<std::mutex> lock(m_lock);
+	while(true) {
+		m_wake.wait(lock, [this, &batch]() { return m_stopping || m_batch != batch; });
+		if(m_stopping)
+			return;
+
+		batch = m_batch;
+		const std::function<void(size_t)>& task = *m_task;
+		size_t count = m_count;
+		lock.unlock();
+
+		drain(task, count);
+
+		lock.lock();
+		if(--m_active == 0)
+			m_done.notify_all();
+	}
+}
+
+void
+WorkerPool::drain(const std::function<void(size_t)>& task, size_t count) {
+	// Tasks are claimed one by one, a slow task doesn't hold back a whole share of the batch
+	size_t index = 0;
+	while((index = m_next.fetch_add(1, std::memory_order_relaxed)) < count) {
+		try {
+			task(index);
+		}
+		catch(...) {
+			std::lock_guard<std::mutex> lock(m_lock);
+			if(m_error == nullptr)
+				m_error = std::current_exception();
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,221 @@
+/*
+ * Std Includes
+ */
+#include <chrono>
+#include <new>
+
+/*
+ * Qt Includes
+ */
+#include <QCoreApplication>
+#include <QString>
+#include <QThread>
+
+/*
+ * Plugin Includes
+ */
+#include "include/common/Logger.hpp"
+#include "include/events/SignalQueue.hpp"
+
+/*
+========================================================================================================
+	Static Attributes Initializations
+========================================================================================================
+*/
+
+const QEvent::Type SignalWakeEvent::Type = static_cast<QEvent::Type>(QEvent::registerEventType());
+
+void* SignalWakeEvent::_slots[SIGNAL_WAKE_EVENTS] = { nullptr };
+
+std::atomic<uint32_t> SignalWakeEvent::_used(0);
+
+MPSCQueue<SignalRecord> SignalQueue::_records(SIGNAL_QUEUE_CAPACITY);
+
+std::atomic<bool> SignalQueue::_scheduled(false);
+
+SignalReceiver* SignalQueue::_receiver = nullptr;
+
+std::mutex SignalQueue::_receiverLock;
+
+size_t SignalQueue::_spilled = 0;
+
+/*
+========================================================================================================
+	Wake Event
+========================================================================================================
+*/
+
+SignalWakeEvent::SignalWakeEvent() :
+	QEvent(SignalWakeEvent::Type) {
+}
+
+SignalWakeEvent::~SignalWakeEvent() {
+}
+
+void
+SignalWakeEvent::allocateSlots() {
+	for(size_t i = 0; i < SIGNAL_WAKE_EVENTS; i++) {
+		if(_slots[i] == nullptr)
+			_slots[i] = ::operator new(sizeof(SignalWakeEvent));
+	}
+}
+
+void
+SignalWakeEvent::releaseSlots() {
+	// Only once no event is in flight anymore, the receiver took its pending events with it
+	for(size_t i = 0; i < SIGNAL_WAKE_EVENTS; i++) {
+		::operator delete(_slots[i]);
+		_slots[i] = nullptr;
+	}
+	_used.store(0, std::memory_order_release);
+}
+
+void*
+SignalWakeEvent::operator new(size_t size) {
+	uint32_t used = _used.load(std::memory_order_acquire);
+	size_t i = 0;
+	while(size == sizeof(SignalWakeEvent) && i < SIGNAL_WAKE_EVENTS) {
+		uint32_t bit = 1u << i;
+		if(_slots[i] == nullptr || (used & bit) != 0) {
+			i++;
+			continue;
+		}
+
+		if(_used.compare_exchange_weak(used, used | bit, std::memory_order_acq_rel))
+			return _slots[i];
+
+		// Lost the race, used now holds the fresh mask
+		i = 0;
+	}
+	return ::operator new(size);
+}
+
+void
+SignalWakeEvent::operator delete(void* pointer) {
+	for(size_t i = 0; i < SIGNAL_WAKE_EVENTS; i++) {
+		if(pointer != nullptr && pointer == _slots[i]) {
+			_used.fetch_and(~(1u << i), std::memory_order_acq_rel);
+			return;
+		}
+	}
+	::operator delete(pointer);
+}
+
+bool
+SignalReceiver::event(QEvent* event) {
+	if(event->type() != SignalWakeEvent::Type)
+		return QObject::event(event);
+
+	SignalQueue::drain();
+	return true;
+}
+
+/*
+========================================================================================================
+	Initialization
+========================================================================================================
+*/
+
+void
+SignalQueue::initialize() {
+	std::lock_guard<std::mutex> lock(_receiverLock);
+	if(_receiver != nullptr || QCoreApplication::instance() == nullptr)
+		return;
+
+	SignalWakeEvent::allocateSlots();
+	_receiver = new SignalReceiver();
+}
+
+/*
+========================================================================================================
+	Producers
+========================================================================================================
+*/
+
+void
+SignalQueue::post(SignalRecord&& record) {
+	// The model thread can't wait on itself, it makes room by dispatching what is pending
+	if(onModelThread()) {
+		if(!_records.tryPush(record)) {
+			drain();
+			_records.push(std::move(record), std::chrono::milliseconds(0));
+		}
+	}
+	else {
+		_records.push(std::move(record), std::chrono::milliseconds(SIGNAL_QUEUE_BACKPRESSURE_MS));
+	}
+
+	// Only the first signal of a burst schedules a drain
+	if(_scheduled.exchange(true, std::memory_order_acq_rel))
+		return;
+
+	// Producers never drain, records only leave the queue on the model thread. Without receiver
+	// they wait for the next drain of the model thread, or for clear() on shutdown
+	std::lock_guard<std::mutex> lock(_receiverLock);
+	if(_receiver != nullptr)
+		QCoreApplication::postEvent(_receiver, new SignalWakeEvent());
+	else
+		_scheduled.store(false, std::memory_order_release);
+}
+
+/*
+========================================================================================================
+	Consumer
+========================================================================================================
+*/
+
+void
+SignalQueue::drain() {
+	if(!onModelThread())
+		return;
+
+	// Reset first, a signal posted while draining schedules the next batch
+	_scheduled.store(false, std::memory_order_release);
+
+	SignalRecord record;
+	while(_records.pop(record))
+		record.dispatch(record, true);
+
+	size_t spilled = _records.spilled();
+	if(spilled != _spilled) {
+		log_warn << QString("%1 signals overflowed the signal queue.").arg(spilled - _spilled).toStdString() << log_end;
+		_spilled = spilled;
+	}
+}
+
+void
+SignalQueue::clear() {
+	SignalRecord record;
+	while(_records.pop(record))
+		record.dispatch(record, false);
+
+	std::lock_guard<std::mutex> lock(_receiverLock);
+	if(_receiver != nullptr) {
+		delete _receiver;
+		_receiver = nullptr;
+		SignalWakeEvent::releaseSlots();
+	}
+	_scheduled.store(false, std::memory_order_release);
+}
+
+bool
+SignalQueue::onModelThread() {
+	// Without application no thread can tell it is the consumer
+	QCoreApplication* application = QCoreApplication::instance();
+	return application != nullptr && QThread::currentThread() == application->thread();
+}
+
+/*
+========================================================================================================
+	OBS References
+========================================================================================================
+*/
+
+obs_source_t*
+SignalQueue::retain(obs_source_t* source) {
+	// A source being destroyed can't be referenced anymore, the weak reference tells it apart
+	obs_weak_source_t* weak_source = obs_source_get_weak_source(source);
+	obs_source_t* strong_source = obs_weak_source_get_source(weak_source);
+	obs_weak_source_release(weak_source);
+	return strong_source;
+}
\ No newline at end of file
@@ -4,6 +4,19 @@
 #include "include/obs/Collection.hpp"
 #include "include/common/Logger.hpp"
 
+/*
+ * STL Includes
+ */
+#include <algorithm>
+
+/*
+========================================================================================================
+	Static Attributes Initializations
+========================================================================================================
+*/
+
+std::atomic<uint64_t> Collection::_last_version(0);
+
 /*
 ========================================================================================================
 	Constructors / Destructor
@@ -12,14 +25,29 @@
 
 Collection::Collection(uint16_t id, std::string name) :
 	OBSStorable(id, name),
-	m_activeScene(nullptr),
-	switching(false),
 	active(false),
+	switching(false),
+	m_arena(std::make_shared<Arena>()),
+	m_activeScene(nullptr),
 	m_lastSceneID(0x0),
-	m_lastSourceID(0x0) {
+	m_lastSourceID(0x0),
+	m_version(++_last_version),
+	m_journalFloor(0),
+	m_uncheckedChanges(0),
+	m_mismatches(0),
+	m_deferred(false),
+	m_snapshot(std::make_shared<Snapshot>()) {
+	m_journalFloor = m_version;
+	m_snapshot->collection = id;
+	m_snapshot->revision = m_version;
+	m_snapshot->active = false;
 }
 
 Collection::~Collection() {
+	// Handles go stale in one pass, the storages are then freed without any bookkeeping
+	m_itemHandles.clear();
+	m_sceneHandles.clear();
+	m_sourceHandles.clear();
 }
 
 /*
@@ -29,34 +57,28 @@ Collection::~Collection() {
 */
 
 Collection*
-Collection::buildFromMemory(Memory& memory) {
+Collection::buildFromBuffer(BufferReader& reader) {
 	uint16_t id = 0;
-	unsigned int namelen = 0;
-	char collection_name[MAX_NAME_LENGTH];
+	std::string collection_name;
 	short nb_scenes = 0, nb_sources = 0;
 
-	if(memory == nullptr)
+	if(!reader.read(id) || !reader.read(collection_name))
 		return nullptr;
 
-	memory.read((byte*)&id, sizeof(uint16_t));
-	memory.read((byte*)&namelen, sizeof(unsigned int));
-	collection_name[namelen] = 0;
-	memory.read(collection_name, namelen);
-
 	Collection* collection = new Collection(id, collection_name);
 
-	memory.read((byte*)&nb_sources, sizeof(short));
+	reader.read(nb_sources);
 
 	while(nb_sources > 0) {
 		size_t block_size = 0;
-		memory.read((byte*)&block_size, sizeof(size_t));
-		void* end_of_block = memory.tell() + block_size;
-		Source* source = Source::buildFromMemory(collection, memory);
+		reader.read(block_size);
+		size_t end_of_block = reader.position() + block_size;
+		std::shared_ptr<Source> source = Source::buildFromBuffer(collection, reader);
 		if(source != nullptr) {
 			collection->m_sources.push(source);
 			collection->m_lastSourceID = std::max<uint16_t>(collection->m_lastSourceID, source->id());
 		}
-		if(memory.tell() != end_of_block) {
+		if(reader.failed() || reader.position() != end_of_block) {
 			delete collection;
 			collection = nullptr;
 			nb_sources = 0;
@@ -64,18 +86,21 @@ Collection::buildFromMemory(Memory& memory) {
 		nb_sources--;
 	}
 
-	memory.read((byte*)&nb_scenes, sizeof(short));
+	if(collection == nullptr)
+		return nullptr;
+
+	reader.read(nb_scenes);
 
 	while(nb_scenes > 0) {
 		size_t block_size = 0;
-		memory.read((byte*)&block_size, sizeof(size_t));
-		void* end_of_block = memory.tell() + block_size;
-		Scene* scene = Scene::buildFromMemory(collection, memory);
+		reader.read(block_size);
+		size_t end_of_block = reader.position() + block_size;
+		std::shared_ptr<Scene> scene = Scene::buildFromBuffer(collection, reader);
 		if(scene != nullptr) {
 			collection->m_scenes.push(scene);
 			collection->m_lastSceneID = std::max<uint16_t>(collection->m_lastSceneID, scene->id());
 		}
-		if(memory.tell() != end_of_block) {
+		if(reader.failed() || reader.position() != end_of_block) {
 			delete collection;
 			collection = nullptr;
 			nb_scenes = 0;
@@ -92,11 +117,8 @@ Collection::buildFromMemory(Memory& memory) {
 ========================================================================================================
 */
 
-Memory
-Collection::toMemory(size_t& size) const {
-
-	std::vector<Memory> blocks;
-
+void
+Collection::toBuffer(BufferWriter& writer) const {
 	/*BLOCK
 		id (short)
 		namelen (unsigned int)
@@ -110,49 +132,23 @@ Collection::toMemory(size_t& size) const {
 			block_size (size_t)
 			block_scene (block_size)
 	*/
-	unsigned int namelen = static_cast<unsigned int>(strlen(m_name.c_str()));
-	size_t total_size = sizeof(uint16_t) + sizeof(unsigned int) + namelen + 2*sizeof(short);
+	writer.write(m_identifier);
+	writer.write(m_name.str());
 
-	short nb_sources = static_cast<short>(m_sources.size());
+	// Blocks are written in place, their size is patched once they are complete
+	writer.write(static_cast<short>(m_sources.size()));
 	for(auto iter = m_sources.begin(); iter != m_sources.end(); iter++) {
-		total_size += sizeof(size_t);
-		blocks.push_back(iter->second->toMemory(total_size));
+		size_t block = writer.beginBlock();
+		iter->second->toBuffer(writer);
+		writer.endBlock(block);
 	}
 
-	short nb_scenes = static_cast<short>(m_scenes.size());
+	writer.write(static_cast<short>(m_scenes.size()));
 	for(auto iter = m_scenes.begin(); iter != m_scenes.end(); iter++) {
-		total_size += sizeof(size_t);
-		blocks.push_back(iter->second->toMemory(total_size));
-	}
-
-	Memory block(total_size);
-	block.write((byte*)&m_identifier, sizeof(uint16_t));
-	block.write((byte*)&namelen, sizeof(unsigned int));
-	block.write((byte*)m_name.c_str(), namelen);
-
-	block.write((byte*)&nb_sources, sizeof(short));
-	auto iter = blocks.begin();
-	unsigned int i = 0;
-	while( i < nb_sources ) {
-		size_t sc_size = iter->size();
-		block.write((byte*)&sc_size, sizeof(size_t));
-		block.write(*iter, iter->size());
-		i++;
-		iter++;
-	}
-
-	block.write((byte*)&nb_scenes, sizeof(short));
-	i = 0;
-	while ( i < nb_scenes ) {
-		size_t sc_size = iter->size();
-		block.write((byte*)&sc_size, sizeof(size_t));
-		block.write(*iter, iter->size());
-		i++;
-		iter++;
+		size_t block = writer.beginBlock();
+		iter->second->toBuffer(writer);
+		writer.endBlock(block);
 	}
-
-	size += total_size;
-	return block;
 }
 
 /*
@@ -169,11 +165,89 @@ Collection::makeActive() {
 	m_activeScene = m_scenes[name];
 }
 
+void
+Collection::load(obs_data_t* data) {
+	std::map<std::string, obs_data_t*> sources;
+	std::map<std::string, obs_data_t*> scenes;
+	GroupItems groups;
+
+	obs_data_array_t* obs_sources = obs_data_get_array(data, "sources");
+	size_t count = obs_data_array_count(obs_sources);
+	for(size_t i = 0; i < count; i++) {
+		obs_data_t* source_data = obs_data_array_item(obs_sources, i);
+		const char* name = obs_data_get_string(source_data, "name");
+		const char* type = obs_data_get_string(source_data, "id");
+		if(strcmp(type, "scene") == 0)
+			scenes.insert(std::make_pair(name, source_data));
+		else {
+			sources.insert(std::make_pair(name, source_data));
+			if(strcmp(type, "group") == 0) {
+				obs_data_t* settings = obs_data_get_obj(source_data, "settings");
+				groups.insert(std::make_pair(name, obs_data_get_array(settings, "items")));
+				obs_data_release(settings);
+			}
+		}
+	}
+	obs_data_array_release(obs_sources);
+
+	// Same reconciliation as the live loaders, by name, keeping the identifiers already known
+	std::vector<uint16_t> removed;
+	for(auto iter = m_sources.begin(); iter != m_sources.end(); iter++) {
+		auto source_find = sources.find(iter->second->name());
+		if(source_find == sources.end())
+			removed.push_back(iter->first);
+		else
+			iter->second->load(source_find->second);
+	}
+	for(auto iter = removed.begin(); iter != removed.end(); iter++)
+		popSource(*iter);
+	for(auto iter = sources.begin(); iter != sources.end(); iter++) {
+		if(m_sources[iter->first] != nullptr)
+			continue;
+		m_lastSourceID++;
+		m_sources.push(make<Source>(this, m_lastSourceID, iter->first))->load(iter->second);
+	}
+
+	removed.clear();
+	for(auto iter = m_scenes.begin(); iter != m_scenes.end(); iter++) {
+		if(scenes.find(iter->second->name()) == scenes.end())
+			removed.push_back(iter->first);
+	}
+	for(auto iter = removed.begin(); iter != removed.end(); iter++)
+		popScene(*iter);
+	for(auto iter = scenes.begin(); iter != scenes.end(); iter++) {
+		if(m_scenes[iter->first] != nullptr)
+			continue;
+		m_lastSceneID++;
+		m_scenes.push(make<Scene>(this, m_lastSceneID, iter->first));
+	}
+
+	// Items may reference any scene, they are loaded once every scene exists
+	for(auto iter = scenes.begin(); iter != scenes.end(); iter++)
+		m_scenes[iter->first]->load(iter->second, groups);
+
+	for(auto iter = sources.begin(); iter != sources.end(); iter++)
+		obs_data_release(iter->second);
+	for(auto iter = scenes.begin(); iter != scenes.end(); iter++)
+		obs_data_release(iter->second);
+	for(auto iter = groups.begin(); iter != groups.end(); iter++)
+		obs_data_array_release(iter->second);
+
+	m_deferred = true;
+	this->touch();
+}
+
 void
 Collection::synchronize() {
+	if(m_deferred) {
+		// First activation of a collection read from its file
+		m_deferred = false;
+		loadSources();
+		loadScenes();
+	}
 
 	auto p = [](void* sources, obs_source_t* obs_source) -> bool {
-		OBSStorage<Source> sources_storage = *reinterpret_cast<OBSStorage<Source>*>(sources);
+		OBSStorage<Source>& sources_storage = *reinterpret_cast<OBSStorage<Source>*>(sources);
 		const char* source_name = obs_source_get_name(obs_source);
 		auto source = sources_storage[source_name];
 		log_info << QString("Source %1 sourced.").arg(source_name).toStdString() << log_end;
@@ -214,77 +288,116 @@ Collection::loadScenes() {
 		scenes.insert(std::string(obs_scenes[i]));
 		++i;
 	}
-	auto iter = m_scenes.begin();
-	while(iter != m_scenes.end()) {
+	// Popping invalidates the storage iterators, removals are applied afterwards
+	std::vector<uint16_t> removed;
+	for(auto iter = m_scenes.begin(); iter != m_scenes.end(); iter++) {
 		auto scene_find = scenes.find(iter->second->name());
-		if(scene_find == scenes.end()) {
-			auto remove = iter;
-			iter++;
-			m_scenes.pop(remove->first);
-		}
-		else {
+		if(scene_find == scenes.end())
+			removed.push_back(iter->first);
+		else
 			scenes.erase(scene_find);
-			iter++;
-		}
 	}
+	for(auto iter = removed.begin(); iter != removed.end(); iter++)
+		popScene(*iter);
 	for(auto iter = scenes.begin(); iter != scenes.end(); iter++) {
 		m_lastSceneID++;
-		m_scenes.push(new Scene(this, m_lastSceneID, *iter));
+		m_scenes.push(make<Scene>(this, m_lastSceneID, *iter));
 	}
 
 	bfree(obs_scenes);
+	m_uncheckedChanges = 0;
+	this->touch();
 }
 
 obs::scene::event
 Collection::updateScenes(std::shared_ptr<Scene>& scene_updated) {
 	obs::scene::event event = obs::scene::event::LIST_BUILD;
-	std::set<std::string> scenes;
-	for(auto iter = m_scenes.begin(); iter != m_scenes.end(); iter++) {
-		scenes.insert(iter->second->name());
-	}
 
 	obs_frontend_source_list obs_scenes = {};
 	obs_frontend_get_scenes(&obs_scenes);
 
 	int64_t j = -1;
-	for(int64_t i = 0; i < obs_scenes.sources.num; i++) {
-		auto iter = scenes.find(obs_source_get_name(obs_scenes.sources.array[i]));
-		if(iter != scenes.end()) {
-			scenes.erase(iter);
-		}
-		else {
-			j = i;
-		}
-	}
+	size_t differences = 0;
+	Scene* unlisted = diffScenes(obs_scenes, j, differences);
 
 	if(j == -1) {
 		// Fake event - it happens when source and scene triggers both renamed
-		if(scenes.size() == 0)
+		if(unlisted == nullptr) {
+			obs_frontend_source_list_free(&obs_scenes);
 			return event;
-		scene_updated = m_scenes.pop(*scenes.begin());
+		}
+		scene_updated = popScene(unlisted->id());
 		event = obs::scene::event::REMOVED;
 	}
 	else {
 		const char* name = obs_source_get_name(obs_scenes.sources.array[j]);
-		if(scenes.size() == 0) {
+		if(unlisted == nullptr) {
 			m_lastSceneID++;
-			scene_updated = std::shared_ptr<Scene>(new Scene(this, m_lastSceneID, name));
+			scene_updated = make<Scene>(this, m_lastSceneID, name);
 			m_scenes.push(scene_updated);
 			scene_updated->source(obs_scenes.sources.array[j]);
 			this->makeActive();
 			event = obs::scene::event::ADDED;
 		}
 		else {
-			scene_updated = m_scenes.move(*scenes.begin(), name);
+			std::string old_name = unlisted->name();
+			scene_updated = m_scenes.move(old_name, name);
+			this->reindex(old_name, scene_updated->interned());
 			event = obs::scene::event::RENAMED;
 		}
 	}
 
 	obs_frontend_source_list_free(&obs_scenes);
+	this->touch(*scene_updated, event == obs::scene::event::REMOVED);
 
 	return event;
 }
 
+bool
+Collection::checkScenes() {
+	// Scenes signals keep the index up to date, it is checked against OBS once in a while
+	if(m_uncheckedChanges < COLLECTION_CHECK_INTERVAL)
+		return true;
+	return verifyScenes() == 0;
+}
+
+size_t
+Collection::verifyScenes() {
+	obs_frontend_source_list obs_scenes = {};
+	obs_frontend_get_scenes(&obs_scenes);
+
+	int64_t unknown = -1;
+	size_t differences = 0;
+	diffScenes(obs_scenes, unknown, differences);
+	m_uncheckedChanges = 0;
+
+	if(differences != 0) {
+		m_mismatches += differences;
+		logWarning(QString("Scenes of %1 out of sync with OBS (%2 differences, %3 so far), scenes reloaded.")
+			.arg(this->name().c_str())
+			.arg(differences)
+			.arg(m_mismatches)
+			.toStdString()
+		);
+
+		// OBS is right, listed scenes are bound again as on synchronization
+		this->loadScenes();
+		for(size_t i = 0; i < obs_scenes.sources.num; i++) {
+			Scene* scene = m_scenes[obs_source_get_name(obs_scenes.sources.array[i])];
+			if(scene != nullptr)
+				scene->source(obs_scenes.sources.array[i]);
+		}
+	}
+
+	obs_frontend_source_list_free(&obs_scenes);
+	return differences;
+}
+
+size_t
+Collection::mismatches() const {
+	return m_mismatches;
+}
+
 bool
 Collection::switchScene(uint16_t id) {
 	Scene* scene = m_scenes[id];
@@ -304,21 +417,31 @@ Collection::switchScene(const char* name) {
 
 Scene*
 Collection::addScene(obs_source_t* scene) {
+	m_uncheckedChanges++;
 	m_lastSceneID++;
-	Scene* scene_ref = m_scenes.push(new Scene(this, m_lastSceneID, scene)).get();
+	Scene* scene_ref = m_scenes.push(make<Scene>(this, m_lastSceneID, scene)).get();
 	this->makeActive();
+	this->touch(*scene_ref);
 
 	return scene_ref;
 }
 
 std::shared_ptr<Scene>
 Collection::removeScene(Scene& scene) {
-	return m_scenes.pop(scene.id());
+	m_uncheckedChanges++;
+	return popScene(scene.id());
 }
 
 std::shared_ptr<Scene>
 Collection::renameScene(Scene& scene, const char* name) {
-	return m_scenes.move(scene.name(), name);
+	m_uncheckedChanges++;
+	std::string old_name = scene.name();
+	std::shared_ptr<Scene> renamed = m_scenes.move(old_name, name);
+	if(renamed != nullptr)
+		this->reindex(old_name, renamed->interned());
+	// Journaled once renamed, the snapshot takes the new name
+	this->touch(scene);
+	return renamed;
 }
 
 Scene*
@@ -327,7 +450,7 @@ Collection::getSceneById(uint16_t id) const {
 }
 
 Scene*
-Collection::getSceneByName(const std::string& name) const {
+Collection::getSceneByName(std::string_view name) const {
 	return m_scenes[name];
 }
 
@@ -350,24 +473,25 @@ Collection::loadSources() {
 
 	obs_enum_sources(p, &sources);
 
-	auto iter = m_sources.begin();
-	while(iter != m_sources.end()) {
+	// Popping invalidates the storage iterators, removals are applied afterwards
+	std::vector<uint16_t> removed;
+	for(auto iter = m_sources.begin(); iter != m_sources.end(); iter++) {
 		auto source_find = sources.find(iter->second->name());
-		if(source_find == sources.end()) {
-			auto remove = iter;
-			iter++;
-			m_sources.pop(remove->first);
-		}
+		if(source_find == sources.end())
+			removed.push_back(iter->first);
 		else {
 			iter->second->source(source_find->second);
 			sources.erase(source_find);
-			iter++;
 		}
 	}
+	for(auto iter = removed.begin(); iter != removed.end(); iter++)
+		popSource(*iter);
 	for(auto iter = sources.begin(); iter != sources.end(); iter++) {
 		m_lastSourceID++;
-		m_sources.push(new Source(this, m_lastSourceID, iter->second));
+		m_sources.push(make<Source>(this, m_lastSourceID, iter->second));
 	}
+
+	this->touch();
 }
 
 Source*
@@ -377,7 +501,8 @@ Collection::addSource(obs_source_t* source) {
 	Source* existing_source = m_sources[source_name];
 	if(existing_source == nullptr) {
 		m_lastSourceID++;
-		existing_source = m_sources.push(new Source(this, m_lastSourceID, source)).get();
+		existing_source = m_sources.push(make<Source>(this, m_lastSourceID, source)).get();
+		this->touch(*existing_source);
 	}
 	return existing_source;
 }
@@ -386,25 +511,32 @@ std::shared_ptr<Source>
 Collection::addSource(Source* source) {
 	Source* existing_source = m_sources[source->id()];
 	if(existing_source != nullptr) {
-		m_sources.pop(source->id());
+		popSource(source->id());
 	}
+	this->touch(*source);
 	return m_sources.push(source);
 }
 
 std::shared_ptr<Source>
 Collection::removeSource(Source& source) {
-	return m_sources.pop(source.id());
+	return popSource(source.id());
 }
 
 std::shared_ptr<Source>
 Collection::removeSource(uint16_t id) {
-	return m_sources.pop(id);
+	return popSource(id);
 }
 
 
 std::shared_ptr<Source>
 Collection::renameSource(Source& source, const char* name) {
-	return m_sources.move(source.name(), name);
+	std::string old_name = source.name();
+	std::shared_ptr<Source> renamed = m_sources.move(old_name, name);
+	if(renamed != nullptr)
+		this->reindex(old_name, renamed->interned());
+	// Journaled once renamed, the snapshot takes the new name
+	this->touch(source);
+	return renamed;
 }
 
 Source*
@@ -413,7 +545,7 @@ Collection::getSourceById(uint16_t id) const {
 }
 
 Source*
-Collection::getSourceByName(const std::string& name) const {
+Collection::getSourceByName(std::string_view name) const {
 	return m_sources[name];
 }
 
@@ -457,7 +589,339 @@ Collection::scenes() const {
 	return scenes;
 }
 
+uint64_t
+Collection::version() const {
+	return m_version;
+}
+
+uint64_t
+Collection::touch() {
+	// Scenes and sources journal their own changes, this one only carries the collection state
+	return record(Change{ 0, false, false, false, 0, true });
+}
+
+uint64_t
+Collection::touch(const Scene& scene, bool removed) {
+	uint64_t version = record(Change{ 0, true, false, removed, scene.id() });
+	publish(scene, removed);
+	return version;
+}
+
+uint64_t
+Collection::touch(const Source& source, bool removed) {
+	uint64_t version = record(Change{ 0, false, source.registrable(), removed, source.id() });
+	publish(source, removed);
+	return version;
+}
+
+uint64_t
+Collection::record(const Change& change) {
+	// Versions are drawn from one counter, a cached answer can't match a newer collection
+	m_version = ++_last_version;
+	m_journal.push_back(change);
+	m_journal.back().revision = m_version;
+
+	if(m_journal.size() > COLLECTION_JOURNAL_SIZE) {
+		m_journalFloor = m_journal.front().revision;
+		m_journal.pop_front();
+	}
+
+	Snapshot& snapshot = writable();
+	snapshot.collection = m_identifier;
+	snapshot.revision = m_version;
+	snapshot.active = active;
+	return m_version;
+}
+
 Scene*
 Collection::activeScene() const {
 	return m_activeScene;
+}
+
+/*
+========================================================================================================
+	Deltas
+========================================================================================================
+*/
+
+Delta
+Collection::delta(uint64_t revision) const {
+	Delta delta;
+	delta.collection = this;
+	delta.from = revision;
+	delta.revision = m_version;
+	delta.snapshot = revision < m_journalFloor || revision > m_version;
+
+	if(delta.snapshot) {
+		Scenes scenes = this->scenes();
+		for(auto iter = scenes.scenes.begin(); iter != scenes.scenes.end(); iter++)
+			delta.scenes.push_back((*iter)->id());
+		Sources sources = this->sources();
+		for(auto iter = sources.sources.begin(); iter != sources.sources.end(); iter++)
+			delta.sources.push_back((((*iter)->registrable() ? 1 : 2) << 16) + (*iter)->id());
+		return delta;
+	}
+
+	// Walking the journal backward, only the last change of each scene or source is kept
+	std::map<uint16_t, bool> scenes;
+	std::map<uint32_t, bool> sources;
+	for(auto iter = m_journal.rbegin(); iter != m_journal.rend() && iter->revision > revision; iter++) {
+		if(iter->collection)
+			continue;
+
+		if(iter->scene) {
+			scenes.emplace(iter->id, iter->removed);
+			// Scenes are listed as sources too
+			sources.emplace((2 << 16) + iter->id, iter->removed);
+		}
+		else {
+			sources.emplace(((iter->registrable ? 1 : 2) << 16) + iter->id, iter->removed);
+		}
+	}
+
+	for(auto iter = scenes.begin(); iter != scenes.end(); iter++) {
+		Scene* scene = iter->second ? nullptr : m_scenes[iter->first];
+		if(scene != nullptr && scene->collection() == this)
+			delta.scenes.push_back(iter->first);
+		else
+			delta.removedScenes.push_back(iter->first);
+	}
+
+	for(auto iter = sources.begin(); iter != sources.end(); iter++) {
+		uint16_t id = iter->first & 0xFFFF;
+		Source* source = nullptr;
+		if(!iter->second) {
+			if((iter->first >> 16) == 1) {
+				source = m_sources[id];
+			}
+			else {
+				Scene* scene = m_scenes[id];
+				source = scene != nullptr ? &scene->sourcedScene() : nullptr;
+			}
+		}
+		if(source != nullptr && source->collection() == this)
+			delta.sources.push_back(iter->first);
+		else
+			delta.removedSources.push_back(iter->first);
+	}
+
+	return delta;
+}
+
+/*
+========================================================================================================
+	Snapshots
+========================================================================================================
+*/
+
+SnapshotPtr
+Collection::snapshot() const {
+	return m_snapshot;
+}
+
+Snapshot&
+Collection::writable() {
+	// A version still held by a reader never changes, the next one shares its nodes
+	if(m_snapshot.use_count() > 1)
+		m_snapshot = std::make_shared<Snapshot>(*m_snapshot);
+	return *m_snapshot;
+}
+
+void
+Collection::publish(const Scene& scene, bool removed) {
+	Snapshot& snapshot = writable();
+
+	// Scenes are listed as sources too
+	auto scene_position = std::lower_bound(snapshot.scenes.begin(), snapshot.scenes.end(), scene.id(),
+		[](const SceneNodePtr& node, uint16_t node_id) { return node->id < node_id; });
+	bool listed = scene_position != snapshot.scenes.end() && (*scene_position)->id == scene.id();
+
+	if(removed) {
+		if(listed)
+			snapshot.scenes.erase(scene_position);
+	}
+	else if(listed)
+		*scene_position = node(scene);
+	else
+		snapshot.scenes.insert(scene_position, node(scene));
+
+	publish(scene.sourcedScene(), removed);
+}
+
+void
+Collection::publish(const Source& source, bool removed) {
+	Snapshot& snapshot = writable();
+
+	uint32_t key = ((source.registrable() ? 1 : 2) << 16) + source.id();
+	auto position = std::lower_bound(snapshot.sources.begin(), snapshot.sources.end(), key,
+		[](const SourceNodePtr& node, uint32_t node_key) { return node->key < node_key; });
+	bool listed = position != snapshot.sources.end() && (*position)->key == key;
+
+	if(removed) {
+		if(listed)
+			snapshot.sources.erase(position);
+	}
+	else if(listed)
+		*position = node(source);
+	else
+		snapshot.sources.insert(position, node(source));
+}
+
+SceneNodePtr
+Collection::node(const Scene& scene) const {
+	std::shared_ptr<SceneNode> scene_node = std::make_shared<SceneNode>(SceneNode{
+		scene.id(), Name(scene.name()), {}, scene.itemCount()
+	});
+
+	// Listed as the wire format always listed them
+	Items items = scene.items();
+	scene_node->items.reserve(items.items.size());
+	for(auto iter = items.items.begin(); iter != items.items.end(); iter++) {
+		// Pending a deletion OBS didn't complete, the item is ignored
+		const Source* source = (*iter)->source();
+		if(source == nullptr)
+			continue;
+
+		scene_node->items.push_back(ItemNode{
+			(*iter)->id(),
+			(*iter)->type(),
+			static_cast<uint32_t>(((source->registrable() ? 1 : 2) << 16) + source->id()),
+			(*iter)->m_visible
+		});
+	}
+	return scene_node;
+}
+
+SourceNodePtr
+Collection::node(const Source& source) const {
+	return std::make_shared<SourceNode>(SourceNode{
+		static_cast<uint32_t>(((source.registrable() ? 1 : 2) << 16) + source.id()),
+		Name(source.name()),
+		source.type(),
+		source.audio(),
+		source.m_muted
+	});
+}
+
+/*
+========================================================================================================
+	Handles
+========================================================================================================
+*/
+
+const Arena&
+Collection::arena() const {
+	return *m_arena;
+}
+
+Name
+Collection::intern(std::string_view name) {
+	return m_names.intern(name);
+}
+
+const NameTable&
+Collection::names() const {
+	return m_names;
+}
+
+Handle<Source>
+Collection::attach(Source* source) {
+	return m_sourceHandles.insert(source);
+}
+
+Handle<Scene>
+Collection::attach(Scene* scene) {
+	return m_sceneHandles.insert(scene);
+}
+
+Handle<Item>
+Collection::attach(Item* item) {
+	return m_itemHandles.insert(item);
+}
+
+void
+Collection::detach(Handle<Source> handle) {
+	m_sourceHandles.erase(handle);
+}
+
+void
+Collection::detach(Handle<Scene> handle) {
+	m_sceneHandles.erase(handle);
+}
+
+void
+Collection::detach(Handle<Item> handle) {
+	m_itemHandles.erase(handle);
+}
+
+Source*
+Collection::resolve(Handle<Source> handle) const {
+	return m_sourceHandles.get(handle);
+}
+
+Scene*
+Collection::resolve(Handle<Scene> handle) const {
+	return m_sceneHandles.get(handle);
+}
+
+Item*
+Collection::resolve(Handle<Item> handle) const {
+	return m_itemHandles.get(handle);
+}
+
+std::shared_ptr<Source>
+Collection::popSource(uint16_t id) {
+	// Every removal is journaled, whether OBS or a reload dropped the source
+	std::shared_ptr<Source> source = m_sources.pop(id);
+	if(source != nullptr) {
+		this->touch(*source, true);
+		detach(source->handle());
+	}
+	return source;
+}
+
+std::shared_ptr<Scene>
+Collection::popScene(uint16_t id) {
+	// Every removal is journaled, whether OBS or a reload dropped the scene
+	std::shared_ptr<Scene> scene = m_scenes.pop(id);
+	if(scene != nullptr) {
+		this->touch(*scene, true);
+		scene->unlink();
+	}
+	return scene;
+}
+
+Scene*
+Collection::diffScenes(const obs_frontend_source_list& obs_scenes, int64_t& unknown, size_t& differences) const {
+	std::vector<bool> listed(m_scenes.size(), false);
+	unknown = -1;
+	differences = 0;
+
+	// Listed names are resolved through the index, without rebuilding any set
+	for(size_t i = 0; i < obs_scenes.sources.num; i++) {
+		auto iter = m_scenes.locate(obs_source_get_name(obs_scenes.sources.array[i]));
+		if(iter == m_scenes.end()) {
+			unknown = static_cast<int64_t>(i);
+			differences++;
+		}
+		else
+			listed[iter - m_scenes.begin()] = true;
+	}
+
+	Scene* unlisted = nullptr;
+	for(size_t position = 0; position < listed.size(); position++) {
+		if(listed[position])
+			continue;
+		if(unlisted == nullptr)
+			unlisted = (m_scenes.begin() + position)->second.get();
+		differences++;
+	}
+	return unlisted;
+}
+
+void
+Collection::reindex(const std::string& old_name, const Name& name) {
+	// Items share the name of their source, a rename reached them too
+	for(auto iter = m_scenes.begin(); iter != m_scenes.end(); iter++)
+		iter->second->reindex(old_name, name);
 }
\ No newline at end of file
@@ -0,0 +1,131 @@
+/*
+ * STL Includes
+ */
+#include <cctype>
+#include <vector>
+
+/*
+ * Plugin Includes
+ */
+#include "include/obs/CollectionLoader.hpp"
+#include "include/common/Logger.hpp"
+
+/*
+ * OBS Includes
+ */
+#include <util/platform.h>
+
+/*
+ * Qt Includes
+ */
+#include <QString>
+
+/*
+========================================================================================================
+	Constructors / Destructor
+========================================================================================================
+*/
+
+CollectionLoader::CollectionLoader(const std::string& directory, WorkerPool& pool, const std::string& skipped) {
+	if(directory.empty())
+		return;
+
+	// The skipped collection is built by OBS anyway, its file would be parsed for nothing
+	std::string skipped_file = skipped.empty() ? std::string() : fileName(skipped) + ".json";
+
+	os_dir_t* dir = os_opendir(directory.c_str());
+	if(dir == nullptr)
+		return;
+
+	std::vector<std::string> paths;
+	struct os_dirent* entry = nullptr;
+	while((entry = os_readdir(dir)) != nullptr) {
+		if(entry->directory)
+			continue;
+
+		const char* extension = os_get_path_extension(entry->d_name);
+		if(extension == nullptr || strcmp(extension, ".json") != 0)
+			continue;
+
+		if(skipped_file == entry->d_name)
+			continue;
+
+		paths.push_back(directory + "/" + entry->d_name);
+	}
+
+	os_closedir(dir);
+
+	// Files are independent, only the parsing runs on the pool
+	std::vector<obs_data_t*> files(paths.size(), nullptr);
+	pool.run(paths.size(), [&paths, &files](size_t i) {
+		files[i] = obs_data_create_from_json_file_safe(paths[i].c_str(), "bak");
+	});
+
+	for(size_t i = 0; i < files.size(); i++) {
+		obs_data_t* data = files[i];
+		if(data == nullptr) {
+			log_warn << QString("Unreadable collection file %1.").arg(paths[i].c_str()).toStdString() << log_end;
+			continue;
+		}
+
+		// Files are named after the collections, but may have been sanitized, the name is read instead
+		const char* name = obs_data_get_string(data, "name");
+		if(*name == 0 || skipped == name || m_collections.find(name) != m_collections.end()) {
+			obs_data_release(data);
+			continue;
+		}
+
+		m_collections.insert(std::make_pair(std::string(name), data));
+	}
+}
+
+CollectionLoader::~CollectionLoader() {
+	for(auto iter = m_collections.begin(); iter != m_collections.end(); iter++)
+		obs_data_release(iter->second);
+}
+
+/*
+========================================================================================================
+	Accessors
+========================================================================================================
+*/
+
+std::string
+CollectionLoader::directory() {
+	char path[512];
+	if(os_get_config_path(path, sizeof(path), COLLECTIONS_DIRECTORY) <= 0)
+		return std::string();
+	return std::string(path);
+}
+
+std::string
+CollectionLoader::fileName(const std::string& name) {
+	// Mirrors how OBS names the file of a collection : spaces become underscores, the other ASCII
+	// punctuation is dropped. A file whose name got a suffix isn't recognized, it's parsed anyway.
+	std::string file;
+	file.reserve(name.size());
+	for(auto iter = name.begin(); iter != name.end(); iter++) {
+		unsigned char c = (unsigned char)*iter;
+		if(isspace(c))
+			file.push_back('_');
+		else if(c >= 0x80 || c == '_' || isalnum(c))
+			file.push_back((char)c);
+	}
+
+	if(file.empty())
+		file = "characters_only";
+	return file;
+}
+
+obs_data_t*
+CollectionLoader::data(const std::string& name) const {
+	auto iter = m_collections.find(name);
+	if(iter == m_collections.end())
+		return nullptr;
+	return iter->second;
+}
+
+size_t
+CollectionLoader::size() const {
+	return m_collections.size();
+}
\ No newline at end of file
@@ -18,23 +18,26 @@
 */
 
 Item::Item(Scene* scene, uint16_t id, obs_sceneitem_t* item) :
-	OBSStorable(id, obs_source_get_name(obs_sceneitem_get_source(item))),
+	OBSStorable(id, scene->collection()->intern(obs_source_get_name(obs_sceneitem_get_source(item)))),
 	m_parentScene(scene),
 	m_item(item),
 	m_ownerItem(nullptr) {
+	m_handle = scene->collection()->attach(this);
 	m_source = obs_sceneitem_get_source(m_item);
 	m_visible = obs_sceneitem_visible(m_item);
 }
 
 Item::Item(Scene* scene, uint16_t id, const std::string& name) :
-	OBSStorable(id, name),
+	OBSStorable(id, scene->collection()->intern(name)),
 	m_parentScene(scene),
-	m_ownerItem(nullptr) {
+	m_ownerItem(nullptr),
+	m_source(nullptr),
+	m_item(nullptr),
+	m_visible(false) {
+	m_handle = scene->collection()->attach(this);
 }
 
 Item::~Item() {
-	if(m_sourceRef != nullptr)
-		m_sourceRef->removeReference(const_cast<Source**>(&m_sourceRef));
 }
 
 /*
@@ -48,9 +51,15 @@ Item::scene() const {
 	return m_parentScene;
 }
 
+Handle<Item>
+Item::handle() const {
+	return m_handle;
+}
+
 const Source*
 Item::source() const {
-	return m_sourceRef;
+	// Null once the source left its collection
+	return m_parentScene->collection()->resolve(m_sourceHandle);
 }
 
 obs_sceneitem_t*
@@ -71,6 +80,7 @@ Item::item(obs_sceneitem_t* item) {
 	m_item = item;
 	m_source = obs_sceneitem_get_source(item);
 	m_visible = obs_sceneitem_visible(m_item);
+	m_parentScene->touch();
 }
 
 const char*
@@ -86,12 +96,11 @@ Item::visible() const {
 bool
 Item::visible(bool toggle, bool rpc_action) {
 	if(m_parentScene->collection()->active) {
+		// OBS still raises item_visible, it's dropped while the scene applies the change
+		if(rpc_action)
+			return m_parentScene->visible(std::vector<ItemPtr>(1, this), toggle);
 		m_visible = toggle;
-		if(rpc_action) {
-			obs_sceneitem_set_visible(m_item, toggle);
-			bool result = obs_sceneitem_visible(m_item);
-			return result == toggle;
-		}
+		m_parentScene->touch();
 		return true;
 	}
 	return false;
@@ -41,13 +41,10 @@ ItemGroup::ItemGroup(Scene* scene, uint16_t id, obs_sceneitem_t* item) :
 		return true;
 	};
 	obs_scene_enum_items(obs_group_from_source(m_source), func, this);
-
-	m_toggling = false;
 }
 
 ItemGroup::ItemGroup(Scene* scene, uint16_t id, const std::string& name) :
 	Item(scene, id, name) {
-	m_toggling = false;
 }
 
 ItemGroup::~ItemGroup() {
@@ -61,6 +58,8 @@ ItemGroup::~ItemGroup() {
 
 void
 ItemGroup::remove(Item* item) {
+	if(item->m_ownerItem == this)
+		item->m_ownerItem = nullptr;
 	m_items.erase(item);
 }
 
@@ -96,21 +95,26 @@ ItemGroup::visible() const {
 
 bool
 ItemGroup::visible(bool toggle, bool rpc_action) {
-	if(m_toggling) return true;
-
 	if(_toggle_subitems == false || !rpc_action)
 		return Item::visible(toggle, rpc_action);
 	else {
-		m_toggling = true;
-		bool result = true;
-		for(auto iter = m_items.begin(); iter != m_items.end(); iter++)
-			result &= (*iter)->visible(toggle, true);
-		m_visible = toggle;
-		obs_sceneitem_set_visible(m_item, false);
-		obs_sceneitem_set_visible(m_item, true);
-
-		m_toggling = false;
-		return result;
+		// Items of nested groups change in the same batch, each group is resized once at the end
+		std::vector<ItemPtr> items;
+		std::vector<ItemPtr> groups;
+		collect(items, groups);
+		return m_parentScene->visible(items, toggle, groups);
+	}
+}
+
+void
+ItemGroup::collect(std::vector<ItemPtr>& items, std::vector<ItemPtr>& groups) {
+	groups.push_back(this);
+	for(auto iter = m_items.begin(); iter != m_items.end(); iter++) {
+		ItemGroup* group = dynamic_cast<ItemGroup*>(*iter);
+		if(group != nullptr)
+			group->collect(items, groups);
+		else
+			items.push_back(*iter);
 	}
 }
 
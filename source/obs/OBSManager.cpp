@@ -4,11 +4,20 @@
 #include <fstream>
 #include <algorithm>
 
+/*
+ * Qt Includes
+ */
+#include <QCoreApplication>
+#include <QMetaObject>
+#include <QString>
+
 /*
  * Plugin Includes
  */
 #include "include/common/Logger.hpp"
+#include "include/events/SignalQueue.hpp"
 #include "include/obs/OBSManager.hpp"
+#include "include/obs/CollectionLoader.hpp"
 
 /*
 ========================================================================================================
@@ -20,10 +29,18 @@ OBSManager::OBSManager() :
 	m_activeCollection(nullptr),
 	m_isLoadingCollection(false),
 	m_lastCollectionID(0x0),
+	m_version(0),
+	m_attachingCollection(nullptr),
+	m_followScenes(false),
+	m_followSources(false),
+	m_attachmentScheduled(false),
+	m_attachmentToken(std::make_shared<bool>(true)),
 	configuration(0x0) {
+	SignalQueue::initialize();
 }
 
 OBSManager::~OBSManager() {
+	SignalQueue::clear();
 }
 
 /*
@@ -35,7 +52,7 @@ OBSManager::~OBSManager() {
 void
 OBSManager::addEventHandler(
 	const obs::frontend::event event,
-	EventObserver<obs::frontend::event>* handler
+	const EventSlot<obs::frontend::event>& handler
 ) {
 #ifdef USE_SCENE_BY_FRONTEND
 	m_frontendEvent.addHandler(std::make_pair(event, handler));
@@ -48,25 +65,34 @@ OBSManager::addEventHandler(
 }
 
 void
-OBSManager::addEventHandler(const obs::save::event event, EventObserver<obs::save::event>* handler) {
+OBSManager::addEventHandler(
+	const obs::save::event event,
+	const EventSlot<obs::save::event>& handler
+) {
 	m_saveEvent.addHandler(std::make_pair(event, handler));
 }
 
 void
 OBSManager::addEventHandler(
 	const obs::output::event event,
-	EventObserver<obs::output::event>* handler
+	const EventSlot<obs::output::event>& handler
 ) {
 	m_outputEvent.addHandler(std::make_pair(event, handler));
 }
 
 void
-OBSManager::addEventHandler(const obs::scene::event event, EventObserver<obs::scene::event>* handler) {
+OBSManager::addEventHandler(
+	const obs::scene::event event,
+	const EventSlot<obs::scene::event>& handler
+) {
 	m_sceneEvent.addHandler(std::make_pair(event, handler));
 }
 
 void
-OBSManager::addEventHandler(const obs::item::event event, EventObserver<obs::item::event>* handler) {
+OBSManager::addEventHandler(
+	const obs::item::event event,
+	const EventSlot<obs::item::event>& handler
+) {
 #ifdef USE_SCENE_BY_FRONTEND
 	m_sceneitemEvent.EventTrigger<SceneItemEventTrigger, obs::item::event>::addHandler(
 		std::make_pair(event, handler)
@@ -77,28 +103,179 @@ OBSManager::addEventHandler(const obs::item::event event, EventObserver<obs::ite
 }
 
 void
-OBSManager::addEventHandler(const obs::source::event event, EventObserver<obs::source::event>* handler) {
+OBSManager::addEventHandler(
+	const obs::source::event event,
+	const EventSlot<obs::source::event>& handler
+) {
 	m_sourceEvent.addHandler(std::make_pair(event, handler));
 }
 
 void
-OBSManager::registerAllSourcesScenes() {
-	Sources sources = m_activeCollection->sources();
-	for(auto iter = sources.sources.begin(); iter < sources.sources.end(); iter++)
-		registerSource(*iter);
+OBSManager::attachSubscribed(bool scenes, bool sources) {
+	// A switch only queues what subscribed clients follow, it is attached in small batches on the
+	// next event loop iterations. Anything else waits for a request to need it
+	followActiveCollection();
+	if(m_activeCollection == nullptr)
+		return;
+
+	m_pendingAttachments.clear();
+	m_followScenes = scenes;
+	m_followSources = sources;
+
+	if(scenes) {
+		Scene* active_scene = m_activeCollection->activeScene();
+		if(active_scene != nullptr)
+			m_pendingAttachments.push_back(PendingAttachment{ true, active_scene->id() });
+
+		Scenes all_scenes = m_activeCollection->scenes();
+		for(auto iter = all_scenes.scenes.begin(); iter < all_scenes.scenes.end(); iter++) {
+			if(*iter != active_scene)
+				m_pendingAttachments.push_back(PendingAttachment{ true, (*iter)->id() });
+		}
+	}
+
+	if(sources) {
+		Sources all_sources = m_activeCollection->sources();
+		for(auto iter = all_sources.sources.begin(); iter < all_sources.sources.end(); iter++) {
+			if((*iter)->registrable())
+				m_pendingAttachments.push_back(PendingAttachment{ false, (*iter)->id() });
+		}
+	}
+
+	scheduleAttachment();
+}
+
+void
+OBSManager::attachScenes() {
+	followActiveCollection();
+	if(m_activeCollection == nullptr)
+		return;
 
+	m_followScenes = true;
 	Scenes scenes = m_activeCollection->scenes();
 	for(auto iter = scenes.scenes.begin(); iter < scenes.scenes.end(); iter++)
-		registerScene(*iter);
+		attachScene(*iter);
+}
+
+void
+OBSManager::attachSources() {
+	followActiveCollection();
+	if(m_activeCollection == nullptr)
+		return;
+
+	m_followSources = true;
+	Sources sources = m_activeCollection->sources();
+	for(auto iter = sources.sources.begin(); iter < sources.sources.end(); iter++)
+		attachSource(*iter);
+}
+
+void
+OBSManager::attachScene(Scene* scene) {
+	followActiveCollection();
+	if(scene == nullptr || scene->collection() != m_activeCollection)
+		return;
+
+	if(!m_attachedScenes.insert(scene->id()).second)
+		return;
+
+	// Signals were not followed until now, the state is read again from OBS
+	scene->synchronize();
+	m_sceneEvent.addScene(scene);
+	m_sceneitemEvent.addScene(scene);
+	Items items = scene->items();
+	for(auto iter = items.items.begin(); iter < items.items.end(); iter++)
+		m_sceneitemEvent.addItem(*iter);
+}
+
+void
+OBSManager::attachSource(Source* source) {
+	followActiveCollection();
+	if(source == nullptr || source->collection() != m_activeCollection)
+		return;
+
+	if(!source->registrable() || source->source() == nullptr)
+		return;
+
+	if(!m_attachedSources.insert(source->id()).second)
+		return;
+
+	// Signals were not followed until now, the state is read again from OBS
+	source->source(source->source());
+	m_sourceEvent.addSource(source);
 }
 
 void
 OBSManager::cleanRegisteredSourcesScenes() {
+	SignalQueue::drain();
+
+	// Only what was attached is connected, the teardown is as large as the attachment was. It can't
+	// be deferred: OBS frees the signal handlers with their sources right after
+	m_pendingAttachments.clear();
+	m_attachingCollection = nullptr;
+	m_attachedScenes.clear();
+	m_attachedSources.clear();
+	m_followScenes = false;
+	m_followSources = false;
 	m_sourceEvent.removeAll();
 	m_sceneEvent.removeAll();
 	m_sceneitemEvent.removeAll();
 }
 
+void
+OBSManager::followActiveCollection() {
+	if(m_attachingCollection == m_activeCollection)
+		return;
+
+	// Ids attached for another collection mean nothing anymore, their handlers are gone with it
+	m_pendingAttachments.clear();
+	m_attachedScenes.clear();
+	m_attachedSources.clear();
+	m_followScenes = false;
+	m_followSources = false;
+	m_attachingCollection = m_activeCollection;
+}
+
+void
+OBSManager::attachPending(size_t count) {
+	if(m_attachingCollection != m_activeCollection) {
+		m_pendingAttachments.clear();
+		return;
+	}
+
+	while(count-- > 0 && !m_pendingAttachments.empty()) {
+		PendingAttachment attachment = m_pendingAttachments.front();
+		m_pendingAttachments.pop_front();
+
+		if(attachment.scene)
+			attachScene(m_activeCollection->getSceneById(attachment.id));
+		else
+			attachSource(m_activeCollection->getSourceById(attachment.id));
+	}
+}
+
+void
+OBSManager::scheduleAttachment() {
+	if(m_attachmentScheduled || m_pendingAttachments.empty())
+		return;
+
+	QCoreApplication* application = QCoreApplication::instance();
+	if(application == nullptr) {
+		attachPending(m_pendingAttachments.size());
+		return;
+	}
+
+	m_attachmentScheduled = true;
+	std::weak_ptr<bool> token = m_attachmentToken;
+	QMetaObject::invokeMethod(application, [this, token]() {
+		if(token.expired())
+			return;
+
+		m_attachmentScheduled = false;
+		attachPending(ATTACHMENT_BATCH_SIZE);
+		scheduleAttachment();
+	}, Qt::QueuedConnection);
+}
+
 /*
 ========================================================================================================
 	Outputs Management
@@ -123,13 +300,21 @@ OBSManager::unregisterOutput(obs_output_t* output) {
 
 void
 OBSManager::registerSource(const Source* source) {
-	if(source->registrable())
+	// Sources appearing while clients follow them are attached right away, their state is fresh
+	followActiveCollection();
+	if(!m_followSources || !source->registrable() || source->collection() != m_activeCollection)
+		return;
+
+	if(m_attachedSources.insert(source->id()).second)
 		m_sourceEvent.addSource(source);
 }
 
 void
 OBSManager::unregisterSource(const Source* source) {
-	if(source->registrable())
+	if(!source->registrable() || source->collection() != m_attachingCollection)
+		return;
+
+	if(m_attachedSources.erase(source->id()) > 0)
 		m_sourceEvent.removeSource(source);
 }
 
@@ -141,6 +326,14 @@ OBSManager::unregisterSource(const Source* source) {
 
 void
 OBSManager::registerScene(const Scene* scene) {
+	// Scenes appearing while clients follow them are attached right away, their state is fresh
+	followActiveCollection();
+	if(!m_followScenes || scene->collection() != m_activeCollection)
+		return;
+
+	if(!m_attachedScenes.insert(scene->id()).second)
+		return;
+
 	m_sceneEvent.addScene(scene);
 	m_sceneitemEvent.addScene(scene);
 	Items items = scene->items();
@@ -150,6 +343,9 @@ OBSManager::registerScene(const Scene* scene) {
 
 void
 OBSManager::unregisterScene(const Scene* scene) {
+	if(scene->collection() != m_attachingCollection || m_attachedScenes.erase(scene->id()) == 0)
+		return;
+
 	m_sceneEvent.removeScene(scene->scene());
 	m_sceneitemEvent.removeScene(scene->scene());
 	Items items = scene->items();
@@ -181,8 +377,10 @@ OBSManager::unregisterItem(const Item* item) {
 
 void
 OBSManager::resetCollection() {
-	if(m_activeCollection != nullptr)
+	if(m_activeCollection != nullptr) {
 		m_activeCollection->active = false;
+		m_activeCollection->touch();
+	}
 	m_activeCollection = nullptr;
 }
 
@@ -191,8 +389,10 @@ OBSManager::makeActive() {
 	char* current_collection = obs_frontend_get_current_scene_collection();
 	if(current_collection == nullptr) return;
 	m_activeCollection = m_collections[current_collection];
-	if(m_activeCollection != nullptr)
+	if(m_activeCollection != nullptr) {
 		m_activeCollection->active = true;
+		m_activeCollection->touch();
+	}
 }
 
 void
@@ -203,6 +403,10 @@ OBSManager::loadCollections(OBSStorage<Collection>& collections, const uint16_t
 
 	m_lastCollectionID = std::max<uint16_t>(m_lastCollectionID, last_collection_id);
 
+	// Inactive collections are built from their files, OBS only switches into the unreadable ones
+	CollectionLoader loader(CollectionLoader::directory(), m_pool, current_collection_bf);
+	std::vector<std::pair<Collection*, obs_data_t*>> deferred;
+
 	char** obs_collections = obs_frontend_get_scene_collections();
 
 	unsigned int i = 0;
@@ -216,15 +420,45 @@ OBSManager::loadCollections(OBSStorage<Collection>& collections, const uint16_t
 
 		m_collections.push(collection);
 
-		switchCollection(collection.get());
-		collection->loadSources();
-		collection->loadScenes();
-		collection->synchronize();
+		char* current_collection = obs_frontend_get_current_scene_collection();
+		bool current = strcmp(current_collection, obs_collections[i]) == 0;
+		bfree(current_collection);
+
+		obs_data_t* data = loader.data(obs_collections[i]);
+		if(!current && data != nullptr) {
+			deferred.push_back(std::make_pair(collection.get(), data));
+		}
+		else {
+			if(!current)
+				switchCollection(collection.get());
+			collection->loadSources();
+			collection->loadScenes();
+			collection->synchronize();
+		}
 		++i;
 	}
 
 	bfree(obs_collections);
+
+	// Each collection only touches its own model, they are built in parallel
+	m_pool.run(deferred.size(), [&deferred](size_t i) {
+		deferred[i].first->load(deferred[i].second);
+	});
+
+	for(auto iter = m_collections.begin(); iter != m_collections.end(); iter++) {
+		const Arena& arena = iter->second->arena();
+		log_info << QString("Collection %1 loaded : %2 model allocations, %3 bytes in %4 blocks.")
+			.arg(iter->second->name().c_str())
+			.arg(arena.allocations())
+			.arg(arena.used())
+			.arg(arena.blocks())
+			.toStdString() << log_end;
+	}
+
+	// Signals raised by the loading must still see it in progress
+	SignalQueue::drain();
 	m_isLoadingCollection = false;
+	m_version++;
 
 	char* current_collection_af = obs_frontend_get_current_scene_collection();
 	if(strcmp(current_collection_bf, current_collection_af) == 0) {
@@ -232,7 +466,8 @@ OBSManager::loadCollections(OBSStorage<Collection>& collections, const uint16_t
 		this->m_activeCollection->synchronize();
 		this->m_activeCollection->makeActive();
 
-		registerAllSourcesScenes();
+		// No client is connected yet, handlers are attached once one of them asks
+		followActiveCollection();
 	}
 	else {
 		this->switchCollection(current_collection_bf);
@@ -243,20 +478,17 @@ obs::collection::event
 OBSManager::updateCollections(std::shared_ptr<Collection>& collection_updated) {
 	obs::collection::event event = obs::collection::event::LIST_BUILD;
 
-	std::set<std::string> collections;
-	for(auto iter = m_collections.begin(); iter != m_collections.end(); iter++) {
-		collections.insert(iter->second->name());
-	}
-
 	char** obs_collections = obs_frontend_get_scene_collections();
 
+	// Listed names are resolved through the index, without rebuilding any set
+	std::vector<bool> listed(m_collections.size(), false);
 	unsigned int i = 0;
 	int j = -1;
 
 	while(obs_collections[i] != NULL) {
-		auto iter = collections.find(obs_collections[i]);
-		if(iter != collections.end()) {
-			collections.erase(iter);
+		auto iter = m_collections.locate(obs_collections[i]);
+		if(iter != m_collections.end()) {
+			listed[iter - m_collections.begin()] = true;
 		}
 		else {
 			j = i;
@@ -264,13 +496,24 @@ OBSManager::updateCollections(std::shared_ptr<Collection>& collection_updated) {
 		i++;
 	}
 
+	std::shared_ptr<Collection> unlisted = nullptr;
+	for(size_t position = 0; position < listed.size() && unlisted == nullptr; position++) {
+		if(!listed[position])
+			unlisted = (m_collections.begin() + position)->second;
+	}
+
 	if(j == -1) {
-		collection_updated = m_collections.pop(*collections.begin());
+		// Nothing changed, the list is only rebuilt
+		if(unlisted == nullptr) {
+			bfree(obs_collections);
+			return event;
+		}
+		collection_updated = m_collections.pop(unlisted->id());
 		event = obs::collection::event::REMOVED;
 	}
 	else {
 		const char* name = obs_collections[j];
-		if(collections.size() == 0) {
+		if(unlisted == nullptr) {
 			m_lastCollectionID++;
 			collection_updated = std::shared_ptr<Collection>(new Collection(m_lastCollectionID, name));
 			m_collections.push(collection_updated);
@@ -282,12 +525,13 @@ OBSManager::updateCollections(std::shared_ptr<Collection>& collection_updated) {
 			event = obs::collection::event::ADDED;
 		}
 		else {
-			collection_updated = m_collections.move(*collections.begin(), name);
+			collection_updated = m_collections.move(unlisted->name(), name);
 			event = obs::collection::event::RENAMED;
 		}
 	}
 
 	bfree(obs_collections);
+	m_version++;
 
 	return event;
 }
@@ -324,6 +568,11 @@ OBSManager::collections() const {
 	return collections;
 }
 
+uint64_t
+OBSManager::version() const {
+	return m_version;
+}
+
 Collection*
 OBSManager::activeCollection() const {
 	return m_activeCollection;
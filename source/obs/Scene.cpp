@@ -11,6 +11,19 @@
  */
 #include <QString>
 
+/*
+ * STL Includes
+ */
+#include <algorithm>
+
+/*
+========================================================================================================
+	Static Attributes Initializations
+========================================================================================================
+*/
+
+thread_local int Scene::_visibility_batches = 0;
+
 /*
 ========================================================================================================
 	Constructors / Destructor
@@ -18,18 +31,27 @@
 */
 
 Scene::Scene(Collection* collection, uint16_t id, obs_source_t* source) :
-	OBSStorable(id, obs_source_get_name(source)),
+	OBSStorable(id, collection->intern(obs_source_get_name(source))),
+	m_internalSource(collection, id, source, false),
 	m_parentCollection(collection),
-	m_internalSource(collection, id, source, false) {
-	this->source(source);
+	m_version(0) {
+	m_handle = m_parentCollection->attach(this);
+	// The internal source was bound and journaled on its construction, only the scene is bound
+	m_source = source;
+	m_scene = obs_scene_from_source(m_source);
+	this->synchronize();
 }
 
 Scene::Scene(Collection* collection, uint16_t id, std::string name) :
-	OBSStorable(id, name),
+	OBSStorable(id, collection->intern(name)),
+	m_internalSource(collection, id, name, false),
 	m_parentCollection(collection),
-	m_internalSource(collection, id, name, false) {
+	m_version(0) {
+	m_handle = m_parentCollection->attach(this);
 	m_source = nullptr;
 	m_scene = nullptr;
+	// Listed from now on, its items come with its load
+	this->touch();
 }
 
 Scene::~Scene() {
@@ -41,23 +63,15 @@ Scene::~Scene() {
 ========================================================================================================
 */
 
-Scene*
-Scene::buildFromMemory(Collection* collection, Memory& memory) {
+std::shared_ptr<Scene>
+Scene::buildFromBuffer(Collection* collection, BufferReader& reader) {
 	uint16_t id = 0;
-	unsigned int namelen = 0;
-	char scene_name[MAX_NAME_LENGTH];
+	std::string scene_name;
 
-	if(memory == nullptr)
+	if(!reader.read(id) || !reader.read(scene_name))
 		return nullptr;
 
-	memory.read((byte*)&id, sizeof(uint16_t));
-	memory.read((byte*)&namelen, sizeof(unsigned int));
-	scene_name[namelen] = 0;
-	memory.read(scene_name, namelen);
-
-	Scene* scene = new Scene(collection, id, scene_name);
-
-	return scene;
+	return collection->make<Scene>(collection, id, scene_name);
 }
 
 /*
@@ -66,25 +80,15 @@ Scene::buildFromMemory(Collection* collection, Memory& memory) {
 ========================================================================================================
 */
 
-Memory
-Scene::toMemory(size_t& size) const {
+void
+Scene::toBuffer(BufferWriter& writer) const {
 	/*BLOCK
 		id (short)
 		namelen (unsigned int)
 		name (namelen)
 	*/
-	unsigned int namelen = static_cast<unsigned int>(strlen(m_name.c_str()));
-	size_t block_size = sizeof(uint16_t) + sizeof(unsigned int) + namelen;
-
-	// TODO
-
-	Memory block(block_size);
-	block.write((byte*)&m_identifier, sizeof(uint16_t));
-	block.write((byte*)&namelen, sizeof(unsigned int));
-	block.write((byte*)m_name.c_str(), namelen);
-
-	size += block_size;
-	return block;
+	writer.write(m_identifier);
+	writer.write(m_name.str());
 }
 
 /*
@@ -107,18 +111,99 @@ Scene::makeActive() {
 
 Item*
 Scene::createItem(obs_sceneitem_t* item) {
+	// A group creates its items while built, it is placed before them
+	size_t position = m_order.size();
 	Item* item_ptr = m_items.push(ItemBuilder::instance()->build(this, item)).get();
+	place(item_ptr->id(), item_ptr->owner() != nullptr ? item_ptr->owner()->id() : 0, position);
+	this->touch();
 	return item_ptr;
 }
 
 std::shared_ptr<Item>
 Scene::deleteItem(Item* item) {
 	std::shared_ptr<Item> item_ptr = m_items.pop(item->id());
+	m_order.erase(
+		std::remove_if(m_order.begin(), m_order.end(), [&](const ItemPlace& entry) { return entry.id == item_ptr->id(); }),
+		m_order.end()
+	);
 	if(item_ptr->owner() != nullptr)
 		item_ptr->owner()->remove(item_ptr.get());
+	m_parentCollection->detach(item_ptr->handle());
+	this->touch();
 	return item_ptr;
 }
 
+bool
+Scene::visible(const std::vector<ItemPtr>& items, bool toggle, const std::vector<ItemPtr>& groups) {
+	if(!m_parentCollection->active)
+		return false;
+
+	// A single item resizes its group once anyway, it needs neither the bracket nor the group set
+	if(items.size() == 1 && groups.empty()) {
+		Item* item = items.front();
+		item->m_visible = toggle;
+		bool result = false;
+		if(item->m_item != nullptr) {
+			// Its signal is dropped as well, the caller notifies the change once
+			_visibility_batches++;
+			obs_sceneitem_set_visible(item->m_item, toggle);
+			_visibility_batches--;
+			result = obs_sceneitem_visible(item->m_item) == toggle;
+		}
+
+		this->touch();
+		return result;
+	}
+
+	// The bracket only defers the bounding box update of the groups until all their items changed,
+	// OBS still raises item_visible for each of them
+	std::set<Item*> resized;
+	auto defer = [&resized](Item* group) {
+		if(group != nullptr && group->item() != nullptr && resized.insert(group).second)
+			obs_sceneitem_defer_group_resize_begin(group->item());
+	};
+	for(auto iter = items.begin(); iter != items.end(); iter++)
+		defer((*iter)->owner());
+	for(auto iter = groups.begin(); iter != groups.end(); iter++)
+		defer(*iter);
+
+	// Signals raised by the batch are its own, the caller notifies the change once
+	_visibility_batches++;
+	bool result = true;
+	for(auto iter = items.begin(); iter != items.end(); iter++) {
+		Item* item = *iter;
+		item->m_visible = toggle;
+		if(item->m_item == nullptr) {
+			result = false;
+			continue;
+		}
+		obs_sceneitem_set_visible(item->m_item, toggle);
+		result &= obs_sceneitem_visible(item->m_item) == toggle;
+	}
+
+	// Toggled groups report the state of their items, but stay shown so their items can be seen
+	for(auto iter = groups.begin(); iter != groups.end(); iter++) {
+		Item* group = *iter;
+		group->m_visible = toggle;
+		if(group->m_item != nullptr) {
+			obs_sceneitem_set_visible(group->m_item, false);
+			obs_sceneitem_set_visible(group->m_item, true);
+		}
+	}
+
+	for(auto iter = resized.begin(); iter != resized.end(); iter++)
+		obs_sceneitem_defer_group_resize_end((*iter)->item());
+	_visibility_batches--;
+
+	this->touch();
+	return result;
+}
+
+bool
+Scene::ApplyingBatch() {
+	return _visibility_batches > 0;
+}
+
 Item*
 Scene::getItemById(uint16_t id) {
 	return m_items[id];
@@ -140,6 +225,124 @@ Scene::synchronize() {
 		return true;
 	};
 	obs_scene_enum_items(m_scene, func, this);
+	m_order = enumerate();
+	this->touch();
+}
+
+bool
+Scene::reorder() {
+	// Reorder signals don't tell what moved, OBS is only asked for the order and items keep
+	// their bindings
+	if(m_scene == nullptr)
+		return false;
+
+	std::vector<ItemPlace> order = enumerate();
+	auto same = [](const ItemPlace& entry, const ItemPlace& other) {
+		return entry.id == other.id && entry.group == other.group;
+	};
+	if(order.size() == m_order.size() && std::equal(order.begin(), order.end(), m_order.begin(), same))
+		return false;
+
+	// Items moved in or out of a group change owner
+	for(auto iter = order.begin(); iter != order.end(); iter++) {
+		Item* item = m_items[iter->id];
+		if(item == nullptr)
+			continue;
+		ItemGroup* group = iter->group != 0 ? dynamic_cast<ItemGroup*>(m_items[iter->group]) : nullptr;
+		if(item->owner() == group)
+			continue;
+		if(item->owner() != nullptr)
+			item->owner()->remove(item);
+		if(group != nullptr)
+			group->add(item);
+	}
+
+	m_order.swap(order);
+	this->touch();
+	return true;
+}
+
+void
+Scene::load(obs_data_t* data, const GroupItems& groups) {
+	m_internalSource.load(data);
+
+	obs_data_t* settings = obs_data_get_obj(data, "settings");
+	obs_data_array_t* items = obs_data_get_array(settings, "items");
+	loadItems(items, nullptr, groups);
+	obs_data_array_release(items);
+	obs_data_release(settings);
+
+	this->touch();
+}
+
+void
+Scene::loadItems(obs_data_array_t* items, ItemGroup* owner, const GroupItems& groups) {
+	size_t count = obs_data_array_count(items);
+	for(size_t i = 0; i < count; i++) {
+		obs_data_t* item_data = obs_data_array_item(items, i);
+		uint16_t id = static_cast<uint16_t>(obs_data_get_int(item_data, "id"));
+
+		Item* item = m_items[id];
+		if(item == nullptr) {
+			std::shared_ptr<Item> built = ItemBuilder::instance()->build(this, item_data);
+			if(built != nullptr)
+				item = m_items.push(built).get();
+		}
+
+		if(item != nullptr) {
+			if(owner != nullptr)
+				owner->add(item);
+			place(item->id(), owner != nullptr ? owner->id() : 0, m_order.size());
+
+			// Grouped items belong to the scene as well, as they do once bound to OBS
+			auto group = groups.find(item->name());
+			ItemGroup* item_group = dynamic_cast<ItemGroup*>(item);
+			if(group != groups.end() && item_group != nullptr)
+				loadItems(group->second, item_group, groups);
+		}
+
+		obs_data_release(item_data);
+	}
+}
+
+void
+Scene::place(uint16_t id, uint16_t group, size_t position) {
+	// Already placed by a reorder seen before the item creation
+	for(auto iter = m_order.begin(); iter != m_order.end(); iter++) {
+		if(iter->id == id)
+			return;
+	}
+
+	// Items placed past the position were created by the group being built
+	for(size_t i = position; i < m_order.size(); i++) {
+		if(m_order[i].group == 0)
+			m_order[i].group = id;
+	}
+	m_order.insert(m_order.begin() + position, { id, group });
+}
+
+std::vector<ItemPlace>
+Scene::enumerate() const {
+	std::vector<ItemPlace> order;
+	order.reserve(m_items.size());
+	std::pair<std::vector<ItemPlace>*, uint16_t> root(&order, 0);
+	obs_scene_enum_items(m_scene, Scene::EnumerateOrder, &root);
+	return order;
+}
+
+bool
+Scene::EnumerateOrder(obs_scene_t* scene, obs_sceneitem_t* item, void* private_data) {
+	auto& context = *reinterpret_cast<std::pair<std::vector<ItemPlace>*, uint16_t>*>(private_data);
+	uint16_t id = static_cast<uint16_t>(obs_sceneitem_get_id(item));
+	context.first->push_back({ id, context.second });
+
+	// Grouped items follow their group
+	obs_scene_t* group = obs_group_from_source(obs_sceneitem_get_source(item));
+	if(group != nullptr) {
+		std::pair<std::vector<ItemPlace>*, uint16_t> nested(context.first, id);
+		obs_scene_enum_items(group, Scene::EnumerateOrder, &nested);
+	}
+	return true;
 }
 
 /*
@@ -153,6 +356,28 @@ Scene::collection() const {
 	return m_parentCollection;
 }
 
+Handle<Scene>
+Scene::handle() const {
+	return m_handle;
+}
+
+void
+Scene::unlink() {
+	// The scene left its collection, handles to it, its items and its source go stale
+	for(auto iter = m_items.begin(); iter != m_items.end(); iter++)
+		m_parentCollection->detach(iter->second->handle());
+	m_parentCollection->detach(m_internalSource.handle());
+	m_parentCollection->detach(m_handle);
+}
+
+void
+Scene::reindex(std::string_view old_name, const Name& name) {
+	for(auto iter = m_items.begin(); iter != m_items.end(); iter++) {
+		if(iter->second->interned() == name)
+			m_items.rename(iter->first, old_name);
+	}
+}
+
 obs_scene_t*
 Scene::scene() const {
 	return m_scene;
@@ -166,7 +391,7 @@ Scene::source() const {
 void
 Scene::source(obs_source_t* obs_source) {
 	m_source = obs_source;
-	m_name = obs_source_get_name(m_source);
+	m_name = m_parentCollection->intern(obs_source_get_name(m_source));
 	m_scene = obs_scene_from_source(m_source);
 	m_internalSource.source(obs_source);
 	this->synchronize();
@@ -182,12 +407,55 @@ Scene::items() const {
 	return items;
 }
 
+Items
+Scene::ordered() const {
+	Items items;
+	items.scene = this;
+	items.items.reserve(m_items.size());
+	for(auto iter = m_order.begin(); iter != m_order.end(); iter++) {
+		Item* item = m_items[iter->id];
+		if(item != nullptr)
+			items.items.push_back(item);
+	}
+
+	// Items OBS didn't list yet come last
+	if(items.items.size() < m_items.size()) {
+		std::vector<uint16_t> placed;
+		placed.reserve(m_order.size());
+		for(auto iter = m_order.begin(); iter != m_order.end(); iter++)
+			placed.push_back(iter->id);
+		std::sort(placed.begin(), placed.end());
+		for(auto iter = m_items.begin(); iter != m_items.end(); iter++) {
+			if(!std::binary_search(placed.begin(), placed.end(), iter->first))
+				items.items.push_back(iter->second.get());
+		}
+	}
+	return items;
+}
+
 unsigned int
 Scene::itemCount() const {
 	return m_items.size();
 }
 
+uint64_t
+Scene::version() const {
+	return m_version;
+}
+
+uint64_t
+Scene::touch() {
+	// Any change of the scene also invalidates what was computed for its collection
+	m_version = m_parentCollection->touch(*this);
+	return m_version;
+}
+
 Source&
 Scene::sourcedScene() {
 	return m_internalSource;
+}
+
+const Source&
+Scene::sourcedScene() const {
+	return m_internalSource;
 }
\ No newline at end of file
@@ -17,22 +17,28 @@
 */
 
 Source::Source(Collection* collection, uint16_t id, obs_source_t* source, bool registrable) :
-	OBSStorable(id, obs_source_get_name(source)),
-	m_parentCollection(collection) {
+	OBSStorable(id, collection->intern(obs_source_get_name(source))),
+	m_parentCollection(collection),
+	m_source(nullptr),
+	m_audio(false),
+	m_muted(false),
+	m_registrable(registrable) {
+	m_handle = m_parentCollection->attach(this);
+	// Binding journals the source, its kind must be known by then
 	this->source(source);
-	m_registrable = registrable;
 }
 
 Source::Source(Collection* collection, uint16_t id, std::string name, bool registrable) :
-	OBSStorable(id, name),
-	m_parentCollection(collection) {
-	m_source = nullptr;
-	m_registrable = registrable;
+	OBSStorable(id, collection->intern(name)),
+	m_parentCollection(collection),
+	m_source(nullptr),
+	m_audio(false),
+	m_muted(false),
+	m_registrable(registrable) {
+	m_handle = m_parentCollection->attach(this);
 }
 
 Source::~Source() {
-	for(auto iter = m_references.begin(); iter != m_references.end(); iter++)
-		**iter = nullptr;
 }
 
 /*
@@ -41,23 +47,15 @@ Source::~Source() {
 ========================================================================================================
 */
 
-Source*
-Source::buildFromMemory(Collection* collection, Memory& memory) {
+std::shared_ptr<Source>
+Source::buildFromBuffer(Collection* collection, BufferReader& reader) {
 	uint16_t id = 0;
-	unsigned int namelen = 0;
-	char source_name[MAX_NAME_LENGTH];
+	std::string source_name;
 
-	if(memory == nullptr)
+	if(!reader.read(id) || !reader.read(source_name))
 		return nullptr;
 
-	memory.read((byte*)&id, sizeof(uint16_t));
-	memory.read((byte*)&namelen, sizeof(unsigned int));
-	source_name[namelen] = 0;
-	memory.read(source_name, namelen);
-
-	Source* source = new Source(collection, id, source_name);
-
-	return source;
+	return collection->make<Source>(collection, id, source_name);
 }
 
 
@@ -67,45 +65,15 @@ Source::buildFromMemory(Collection* collection, Memory& memory) {
 ========================================================================================================
 */
 
-Memory
-Source::toMemory(size_t& size) const {
+void
+Source::toBuffer(BufferWriter& writer) const {
 	/*BLOCK
 		id (short)
 		namelen (unsigned int)
 		name (namelen)
 	*/
-	unsigned int namelen = static_cast<unsigned int>(strlen(m_name.c_str()));
-	size_t block_size = sizeof(uint16_t) + sizeof(unsigned int) + namelen;
-
-	// TODO
-
-	Memory block(block_size);
-	block.write((byte*)&m_identifier, sizeof(uint16_t));
-	block.write((byte*)&namelen, sizeof(unsigned int));
-	block.write((byte*)m_name.c_str(), namelen);
-
-	size += block_size;
-	return block;
-}
-
-/*
-========================================================================================================
-	References Helpers
-========================================================================================================
-*/
-
-void
-Source::addReference(Source** source) {
-	*source = this;
-	m_references.insert(source);
-}
-
-void
-Source::removeReference(Source** source) {
-	if(m_references.find(source) != m_references.end()) {
-		*source = nullptr;
-		m_references.erase(source);
-	}
+	writer.write(m_identifier);
+	writer.write(m_name.str());
 }
 
 /*
@@ -119,6 +87,11 @@ Source::collection() const {
 	return m_parentCollection;
 }
 
+Handle<Source>
+Source::handle() const {
+	return m_handle;
+}
+
 bool
 Source::registrable() const {
 	return m_registrable;
@@ -131,6 +104,17 @@ Source::source(obs_source_t* obs_source) {
 	uint32_t output_flags = obs_source_get_output_flags(m_source);
 	m_audio = (output_flags & OBS_SOURCE_AUDIO) != 0;
 	m_muted = obs_source_muted(m_source);
+	m_parentCollection->touch(*this);
+}
+
+void
+Source::load(obs_data_t* data) {
+	// Saved state of a source OBS didn't create yet, the source itself is bound on activation
+	m_type = obs_data_get_string(data, "id");
+	uint32_t output_flags = obs_get_source_output_flags(m_type.c_str());
+	m_audio = (output_flags & OBS_SOURCE_AUDIO) != 0;
+	m_muted = obs_data_get_bool(data, "muted");
+	m_parentCollection->touch(*this);
 }
 
 obs_source_t*
@@ -155,9 +139,10 @@ Source::muted(bool mute_state, bool rpc_action) {
 		if(rpc_action) {
 			obs_source_set_muted(m_source, mute_state);
 			m_muted = obs_source_muted(m_source);
-			return m_muted == mute_state;
 		}
-		return true;
+		// Journaled with the state OBS kept
+		m_parentCollection->touch(*this);
+		return !rpc_action || m_muted == mute_state;
 	}
 	return false;
 }
@@ -169,6 +154,8 @@ Source::audio() const {
 
 void
 Source::audio(uint64_t flags) {
-	if(m_parentCollection->active)
+	if(m_parentCollection->active) {
 		m_audio = (flags & OBS_SOURCE_AUDIO) != 0;
+		m_parentCollection->touch(*this);
+	}
 }
\ No newline at end of file
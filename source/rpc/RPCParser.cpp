@@ -0,0 +1,582 @@
+/*
+ * CRT Includes
+ */
+#include <cstring>
+#include <climits>
+
+/*
+ * Std Includes
+ */
+#include <algorithm>
+
+/*
+ * Qt Includes
+ */
+#include <QVariantList>
+#include <QVariantMap>
+
+/*
+ * Plugin Includes
+ */
+#include "include/rpc/RPCParser.hpp"
+
+/*
+========================================================================================================
+	Helpers
+========================================================================================================
+*/
+
+#define KEY_EQUALS(key, length, literal) \
+	((length) == sizeof(literal) - 1 && memcmp((key), (literal), sizeof(literal) - 1) == 0)
+
+static void
+append_utf8(std::string& buffer, uint32_t code_point) {
+	if(code_point < 0x80) {
+		buffer.push_back((char)code_point);
+	}
+	else if(code_point < 0x800) {
+		buffer.push_back((char)(0xC0 | (code_point >> 6)));
+		buffer.push_back((char)(0x80 | (code_point & 0x3F)));
+	}
+	else if(code_point < 0x10000) {
+		buffer.push_back((char)(0xE0 | (code_point >> 12)));
+		buffer.push_back((char)(0x80 | ((code_point >> 6) & 0x3F)));
+		buffer.push_back((char)(0x80 | (code_point & 0x3F)));
+	}
+	else {
+		buffer.push_back((char)(0xF0 | (code_point >> 18)));
+		buffer.push_back((char)(0x80 | ((code_point >> 12) & 0x3F)));
+		buffer.push_back((char)(0x80 | ((code_point >> 6) & 0x3F)));
+		buffer.push_back((char)(0x80 | (code_point & 0x3F)));
+	}
+}
+
+static bool
+read_hex4(const char* data, uint32_t& value) {
+	value = 0;
+	for(int i = 0; i < 4; i++) {
+		char c = data[i];
+		value <<= 4;
+		if(c >= '0' && c <= '9')
+			value |= c - '0';
+		else if(c >= 'a' && c <= 'f')
+			value |= c - 'a' + 10;
+		else if(c >= 'A' && c <= 'F')
+			value |= c - 'A' + 10;
+		else
+			return false;
+	}
+	return true;
+}
+
+/*
+========================================================================================================
+	Constructors / Destructor
+========================================================================================================
+*/
+
+rpc::frame_buffer::frame_buffer(size_t capacity) :
+	m_data(capacity),
+	m_head(0),
+	m_size(0),
+	m_scanned(0) {
+}
+
+rpc::frame_buffer::~frame_buffer() {
+}
+
+rpc::parser::parser(const char* data, size_t length) :
+	m_current(data),
+	m_end(data + length),
+	m_depth(0),
+	m_hasSceneId(false),
+	m_hasSceneItemId(false),
+	m_hasSourceId(false) {
+}
+
+rpc::parser::~parser() {
+}
+
+/*
+========================================================================================================
+	Framing
+========================================================================================================
+*/
+
+size_t
+rpc::frame_buffer::size() const {
+	return m_size;
+}
+
+char*
+rpc::frame_buffer::reserve(size_t& length) {
+	if(m_size == 0) {
+		m_head = 0;
+		m_scanned = 0;
+	}
+
+	if(m_size == m_data.size()) {
+		linearize();
+		m_data.resize(m_data.size() * 2);
+	}
+
+	size_t tail = (m_head + m_size) % m_data.size();
+	length = tail >= m_head ? m_data.size() - tail : m_head - tail;
+	return m_data.data() + tail;
+}
+
+void
+rpc::frame_buffer::commit(size_t length) {
+	m_size += length;
+}
+
+bool
+rpc::frame_buffer::next(const char*& frame, size_t& length) {
+	const size_t capacity = m_data.size();
+
+	// Only the bytes received since the last call are scanned for a delimiter
+	while(m_scanned < m_size) {
+		size_t position = (m_head + m_scanned) % capacity;
+		size_t span = std::min(m_size - m_scanned, capacity - position);
+		const char* found = (const char*)memchr(m_data.data() + position, '\n', span);
+		if(found == nullptr) {
+			m_scanned += span;
+			continue;
+		}
+
+		length = m_scanned + (found - (m_data.data() + position));
+
+		// The frame is split by the end of the ring, it has to be made contiguous once
+		if(m_head + length > capacity)
+			linearize();
+
+		frame = m_data.data() + m_head;
+		m_head = (m_head + length + 1) % capacity;
+		m_size -= length + 1;
+		m_scanned = 0;
+		return true;
+	}
+
+	return false;
+}
+
+void
+rpc::frame_buffer::linearize() {
+	std::rotate(m_data.begin(), m_data.begin() + m_head, m_data.end());
+	m_head = 0;
+}
+
+/*
+========================================================================================================
+	Parsing
+========================================================================================================
+*/
+
+bool
+rpc::parser::parse(const char* data, size_t length, message& message) {
+	parser parser(data, length);
+
+	message.event = rpc::event::ERROR;
+	message.args.clear();
+
+	bool result = parser.parseRoot(message);
+	if(!result) {
+		message.event = rpc::event::ERROR;
+	}
+	else {
+		// Because Elgato guys don't know how to make a clear protocol
+		if(parser.m_hasSceneId) {
+			uint64_t scene_id = parser.m_sceneId.toULongLong();
+			uint16_t collection_id = scene_id >> 18;
+			scene_id = (scene_id) & 0x0FFFF;
+
+			message.args.append(QList<QVariant>({ collection_id, (uint16_t)scene_id }));
+		}
+
+		if(parser.m_hasSceneItemId) {
+			uint16_t item_id = parser.m_sceneItemId.toUInt();
+			message.args.append(item_id);
+		}
+
+		if(parser.m_hasSourceId) {
+			uint64_t source_id = parser.m_sourceId.toULongLong();
+			uint16_t collection_id = source_id >> 18;
+			uint16_t type = (source_id >> 16) & 0x03;
+			source_id = (source_id) & 0x0FFFF;
+
+			message.args.append(QList<QVariant>({ collection_id, (uint16_t)type, (uint16_t)source_id }));
+		}
+	}
+
+	switch(message.event) {
+		case rpc::event::ERROR:
+		case rpc::event::NO_EVENT:
+		case rpc::event::MISSING_NO:
+			message.frame = QByteArray(data, (int)length);
+			break;
+		default:
+			break;
+	}
+
+	return result;
+}
+
+bool
+rpc::parser::parseRoot(message& message) {
+	bool has_id = false;
+	double id = 0;
+
+	if(!expect('{'))
+		return false;
+
+	if(peek() == '}') {
+		m_current++;
+	}
+	else {
+		do {
+			const char* key;
+			size_t length;
+			if(!parseKey(key, length))
+				return false;
+
+			bool result;
+			if(KEY_EQUALS(key, length, "id")) {
+				QVariant value;
+				has_id = true;
+				result = parseValue(&value);
+				id = value.type() == QVariant::Double ? value.toDouble() : 0;
+			}
+			else if(KEY_EQUALS(key, length, "method")) {
+				message.method.clear();
+				result = peek() == '"' ? parseString(&message.method) : skipValue();
+			}
+			else if(KEY_EQUALS(key, length, "params")) {
+				result = peek() == '{' ? parseParams(message) : skipValue();
+			}
+			else {
+				result = skipValue();
+			}
+
+			if(!result)
+				return false;
+		} while(expect(','));
+
+		if(!expect('}'))
+			return false;
+	}
+
+	// Only whitespaces may follow the root object
+	if(peek() != '\0' || m_current != m_end)
+		return false;
+
+	// Same conversion as QJsonValue::toInt, non integral identifiers fall back to 0
+	int int_id = id >= INT_MIN && id <= INT_MAX && (double)(int)id == id ? (int)id : 0;
+	message.event = !has_id ? rpc::event::ERROR :
+		int_id >= (int)rpc::event::COUNT ? rpc::event::ERROR :
+		rpc::event(int_id);
+
+	return true;
+}
+
+bool
+rpc::parser::parseParams(message& message) {
+	if(!expect('{'))
+		return false;
+
+	if(peek() == '}') {
+		m_current++;
+		return true;
+	}
+
+	do {
+		const char* key;
+		size_t length;
+		if(!parseKey(key, length))
+			return false;
+
+		bool result;
+		if(KEY_EQUALS(key, length, "resource")) {
+			message.service.clear();
+			result = peek() == '"' ? parseString(&message.service) : skipValue();
+		}
+		else if(KEY_EQUALS(key, length, "args")) {
+			QVariant args;
+			result = parseValue(&args);
+			if(result && args.type() == QVariant::List)
+				message.args = QVector<QVariant>::fromList(args.toList());
+		}
+		else if(KEY_EQUALS(key, length, "sceneId")) {
+			m_hasSceneId = true;
+			m_sceneId.clear();
+			result = peek() == '"' ? parseString(&m_sceneId) : skipValue();
+		}
+		else if(KEY_EQUALS(key, length, "sceneItemId")) {
+			m_hasSceneItemId = true;
+			m_sceneItemId.clear();
+			result = peek() == '"' ? parseString(&m_sceneItemId) : skipValue();
+		}
+		else if(KEY_EQUALS(key, length, "sourceId")) {
+			m_hasSourceId = true;
+			m_sourceId.clear();
+			result = peek() == '"' ? parseString(&m_sourceId) : skipValue();
+		}
+		else {
+			result = skipValue();
+		}
+
+		if(!result)
+			return false;
+	} while(expect(','));
+
+	return expect('}');
+}
+
+bool
+rpc::parser::parseKey(const char*& key, size_t& length) {
+	if(!expect('"'))
+		return false;
+
+	const char* start = m_current;
+	while(m_current < m_end && *m_current != '"' && *m_current != '\\')
+		m_current++;
+
+	if(m_current < m_end && *m_current == '"') {
+		key = start;
+		length = m_current - start;
+		m_current++;
+	}
+	else {
+		// Escaped keys are rare, they are decoded in the scratch buffer
+		m_current = start - 1;
+		QString decoded;
+		if(!parseString(&decoded))
+			return false;
+		m_scratch = decoded.toStdString();
+		key = m_scratch.data();
+		length = m_scratch.size();
+	}
+
+	return expect(':');
+}
+
+bool
+rpc::parser::parseString(QString* value) {
+	if(!expect('"'))
+		return false;
+
+	const char* start = m_current;
+	bool escaped = false;
+
+	m_scratch.clear();
+	while(m_current < m_end) {
+		char c = *m_current;
+		if(c == '"')
+			break;
+
+		if((unsigned char)c < 0x20)
+			return false;
+
+		if(c != '\\') {
+			if(escaped)
+				m_scratch.push_back(c);
+			m_current++;
+			continue;
+		}
+
+		if(!escaped) {
+			m_scratch.assign(start, m_current - start);
+			escaped = true;
+		}
+
+		if(++m_current >= m_end)
+			return false;
+
+		switch(*m_current++) {
+			case '"': m_scratch.push_back('"'); break;
+			case '\\': m_scratch.push_back('\\'); break;
+			case '/': m_scratch.push_back('/'); break;
+			case 'b': m_scratch.push_back('\b'); break;
+			case 'f': m_scratch.push_back('\f'); break;
+			case 'n': m_scratch.push_back('\n'); break;
+			case 'r': m_scratch.push_back('\r'); break;
+			case 't': m_scratch.push_back('\t'); break;
+			case 'u': {
+				uint32_t code_point;
+				if(m_end - m_current < 4 || !read_hex4(m_current, code_point))
+					return false;
+				m_current += 4;
+
+				if(code_point >= 0xD800 && code_point < 0xDC00) {
+					uint32_t low;
+					if(m_end - m_current < 6 || m_current[0] != '\\' || m_current[1] != 'u' ||
+						!read_hex4(m_current + 2, low) || low < 0xDC00 || low > 0xDFFF)
+						return false;
+					m_current += 6;
+					code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+				}
+
+				append_utf8(m_scratch, code_point);
+				break;
+			}
+			default:
+				return false;
+		}
+	}
+
+	if(m_current >= m_end)
+		return false;
+
+	if(value != nullptr) {
+		*value = escaped ? QString::fromUtf8(m_scratch.data(), (int)m_scratch.size()) :
+			QString::fromUtf8(start, (int)(m_current - start));
+	}
+
+	m_current++;
+	return true;
+}
+
+bool
+rpc::parser::parseNumber(double* value) {
+	const char* start = m_current;
+	while(m_current < m_end && (
+		(*m_current >= '0' && *m_current <= '9') ||
+		*m_current == '-' || *m_current == '+' ||
+		*m_current == '.' || *m_current == 'e' || *m_current == 'E'
+	))
+		m_current++;
+
+	if(m_current == start)
+		return false;
+
+	bool result = false;
+	double number = QByteArray::fromRawData(start, (int)(m_current - start)).toDouble(&result);
+	if(result && value != nullptr)
+		*value = number;
+
+	return result;
+}
+
+bool
+rpc::parser::parseValue(QVariant* value) {
+	if(m_depth >= RPC_MAX_DEPTH)
+		return false;
+
+	switch(peek()) {
+		case '"': {
+			if(value == nullptr)
+				return parseString(nullptr);
+			QString string;
+			if(!parseString(&string))
+				return false;
+			*value = string;
+			return true;
+		}
+
+		case '[': {
+			QVariantList list;
+			m_current++;
+			m_depth++;
+			if(peek() == ']') {
+				m_current++;
+			}
+			else {
+				do {
+					QVariant item;
+					if(!parseValue(value != nullptr ? &item : nullptr))
+						return false;
+					if(value != nullptr)
+						list.append(item);
+				} while(expect(','));
+
+				if(!expect(']'))
+					return false;
+			}
+			m_depth--;
+			if(value != nullptr)
+				*value = list;
+			return true;
+		}
+
+		case '{': {
+			QVariantMap map;
+			m_current++;
+			m_depth++;
+			if(peek() == '}') {
+				m_current++;
+			}
+			else {
+				do {
+					QString key;
+					QVariant item;
+					if(!parseString(value != nullptr ? &key : nullptr) || !expect(':'))
+						return false;
+					if(!parseValue(value != nullptr ? &item : nullptr))
+						return false;
+					if(value != nullptr)
+						map.insert(key, item);
+				} while(expect(','));
+
+				if(!expect('}'))
+					return false;
+			}
+			m_depth--;
+			if(value != nullptr)
+				*value = map;
+			return true;
+		}
+
+		case 't':
+			if(m_end - m_current < 4 || memcmp(m_current, "true", 4) != 0)
+				return false;
+			m_current += 4;
+			if(value != nullptr)
+				*value = true;
+			return true;
+
+		case 'f':
+			if(m_end - m_current < 5 || memcmp(m_current, "false", 5) != 0)
+				return false;
+			m_current += 5;
+			if(value != nullptr)
+				*value = false;
+			return true;
+
+		case 'n':
+			if(m_end - m_current < 4 || memcmp(m_current, "null", 4) != 0)
+				return false;
+			m_current += 4;
+			if(value != nullptr)
+				*value = QVariant();
+			return true;
+
+		default: {
+			double number = 0;
+			if(!parseNumber(&number))
+				return false;
+			if(value != nullptr)
+				*value = number;
+			return true;
+		}
+	}
+}
+
+bool
+rpc::parser::skipValue() {
+	return parseValue(nullptr);
+}
+
+bool
+rpc::parser::expect(char c) {
+	if(peek() != c)
+		return false;
+	m_current++;
+	return true;
+}
+
+char
+rpc::parser::peek() {
+	while(m_current < m_end &&
+		(*m_current == ' ' || *m_current == '\t' || *m_current == '\r' || *m_current == '\n'))
+		m_current++;
+	return m_current < m_end ? *m_current : '\0';
+}
\ No newline at end of file
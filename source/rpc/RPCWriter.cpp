@@ -0,0 +1,81 @@
+/*
+ * Plugin Includes
+ */
+#include "include/rpc/RPCWriter.hpp"
+
+/*
+========================================================================================================
+	Constructors / Destructor
+========================================================================================================
+*/
+
+rpc::frame::frame() :
+	m_splice(-1),
+	m_superseding(false),
+	m_scope(0) {
+}
+
+rpc::frame::frame(const QByteArray& data, int splice, bool superseding, uint64_t scope) :
+	m_data(data),
+	m_splice(splice),
+	m_superseding(superseding),
+	m_scope(scope) {
+}
+
+rpc::frame::~frame() {
+}
+
+/*
+========================================================================================================
+	Accessors
+========================================================================================================
+*/
+
+bool
+rpc::frame::empty() const {
+	return m_data.isEmpty();
+}
+
+bool
+rpc::frame::spliced() const {
+	return m_splice >= 0;
+}
+
+int
+rpc::frame::splice() const {
+	return m_splice;
+}
+
+bool
+rpc::frame::superseding() const {
+	return m_superseding;
+}
+
+uint64_t
+rpc::frame::scope() const {
+	return m_scope;
+}
+
+const QByteArray&
+rpc::frame::data() const {
+	return m_data;
+}
+
+/*
+========================================================================================================
+	Rendering
+========================================================================================================
+*/
+
+QByteArray
+rpc::frame::render(const std::string& resource) const {
+	if(m_splice < 0)
+		return m_data;
+
+	QByteArray output;
+	output.reserve(m_data.size() + (int)resource.size() + 8);
+	output.append(m_data.constData(), m_splice);
+	rpc::json_writer<QByteArray>(output).escaped(resource.data(), resource.size());
+	output.append(m_data.constData() + m_splice, m_data.size() - m_splice);
+	return output;
+}
\ No newline at end of file
@@ -213,11 +213,12 @@ ApplicationService::loadDatabase(OBSStorage<Collection>& collections) {
 			collections_file.read((byte*)&block_size, sizeof(size_t));
 
 			// Read block
-			Memory block(block_size);
-			collections_file.read(block, block_size);
+			Buffer block(block_size);
+			collections_file.read(block.data(), block_size);
 
 			// Build collection (Threadable)
-			collection = Collection::buildFromMemory(block);
+			BufferReader reader(block);
+			collection = Collection::buildFromBuffer(reader);
 			if(collection != nullptr) {
 				collections.push(collection);
 				collection_id = std::max<uint16_t>(collection_id, collection->id());
@@ -235,39 +236,34 @@ ApplicationService::loadDatabase(OBSStorage<Collection>& collections) {
 
 void
 ApplicationService::saveDatabase() {
-	std::vector<Memory> collection_blocks;
+	Buffer block;
+	BufferWriter writer(block);
 
 	/*BLOCK
+		configuration (byte)
 		nbCollections (short)
 		foreach(collection)
 			block_size (size_t)
 			block_collection (block_size)
 	*/
 	Collections collections = obsManager()->collections();
-	size_t size = sizeof(short);
-	for(auto collection = collections.begin(); collection != collections.end(); collection++) {
-		size += sizeof(size_t);
-		collection_blocks.push_back((*collection)->toMemory(size));
-	}
 
-	short collections_count = static_cast<short>(collections.size());
-	Memory block(size);
+	// Write configuration
+	writer.write(obsManager()->configuration);
 
 	// Write the number of collections
-	block.write((byte*)&collections_count, sizeof(short));
+	writer.write(static_cast<short>(collections.size()));
 
-	// For each collection
-	for(auto iter = collection_blocks.begin(); iter < collection_blocks.end(); iter++) {
-		size_t size_cl = iter->size();
-		block.write((byte*)&size_cl, sizeof(size_t));
-		block.write((*iter), iter->size());
+	// Each collection is written in place, in a single pass
+	for(auto collection = collections.begin(); collection != collections.end(); collection++) {
+		size_t collection_block = writer.beginBlock();
+		(*collection)->toBuffer(writer);
+		writer.endBlock(collection_block);
 	}
 
 	try {
 		FileLoader collections_file(DATABASE_NAME, std::ios::out);
-		// Write configuration
-		collections_file.write((byte*)&obsManager()->configuration, sizeof(byte));
-		collections_file.write(block, block.size());
+		collections_file.write(block.data(), block.size());
 	}
 	catch(std::exception& e) {
 		log_error << QString("OBS Manager failed on writing file - %1").arg(e.what()).toStdString();
@@ -161,7 +161,24 @@ CollectionsService::onCollectionSwitched() {
 		.toStdString()
 	);
 
-	obsManager()->registerAllSourcesScenes();
+	// Only what connected clients follow is attached again, the rest waits for a request to need it
+	obsManager()->attachSubscribed(
+		streamdeckManager()->subscribed({
+			rpc::event::SCENE_ADDED_SUBSCRIBE,
+			rpc::event::SCENE_REMOVED_SUBSCRIBE,
+			rpc::event::SCENE_SWITCHED_SUBSCRIBE,
+			rpc::event::ITEM_ADDED_SUBSCRIBE,
+			rpc::event::ITEM_REMOVED_SUBSCRIBE,
+			rpc::event::ITEM_UPDATED_SUBSCRIBE,
+			rpc::event::DELTAS_SUBSCRIBE
+		}),
+		streamdeckManager()->subscribed({
+			rpc::event::SOURCE_ADDED_SUBSCRIBE,
+			rpc::event::SOURCE_REMOVED_SUBSCRIBE,
+			rpc::event::SOURCE_UPDATED_SUBSCRIBE,
+			rpc::event::DELTAS_SUBSCRIBE
+		})
+	);
 
 	if(m_collectionUpdated != nullptr) {
 		m_collectionUpdated = nullptr;
@@ -180,7 +197,10 @@ CollectionsService::onCollectionSwitched() {
 	response.event = rpc::event::COLLECTION_SWITCHED_SUBSCRIBE;
 	response.data = collection;
 
-	return active && streamdeckManager()->commit_all(response, &StreamdeckManager::setEvent);
+	// Clients following the active collection get a snapshot of the new one
+	active &= streamdeckManager()->commit_deltas(collection);
+
+	return active && streamdeckManager()->commit_all(response, &StreamdeckManager::renderEvent);
 }
 
 bool
@@ -194,7 +214,7 @@ CollectionsService::onCollectionAdded(const Collection& collection) {
 	rpc::response<void> response = response_void(nullptr, "onCollectionAdded");
 	response.event = rpc::event::COLLECTION_ADDED_SUBSCRIBE;
 
-	return streamdeckManager()->commit_all(response, &StreamdeckManager::setEvent);
+	return streamdeckManager()->commit_coalesced(response);
 }
 
 bool
@@ -208,7 +228,7 @@ CollectionsService::onCollectionRemoved(const Collection& collection) {
 	rpc::response<void> response = response_void(nullptr, "onCollectionRemoved");
 	response.event = rpc::event::COLLECTION_REMOVED_SUBSCRIBE;
 
-	return streamdeckManager()->commit_all(response, &StreamdeckManager::setEvent);
+	return streamdeckManager()->commit_coalesced(response);
 }
 
 bool
@@ -223,7 +243,7 @@ CollectionsService::onCollectionUpdated(const Collection& collection) {
 	response.event = rpc::event::COLLECTION_UPDATED_SUBSCRIBE;
 	response.data = const_cast<CollectionPtr>(&collection);
 
-	return streamdeckManager()->commit_all(response, &StreamdeckManager::setEvent);
+	return streamdeckManager()->commit_all(response, &StreamdeckManager::renderEvent);
 }
 
 /*
@@ -268,6 +288,9 @@ CollectionsService::onFetchCollectionsSchema(const rpc::request& data) {
 		response.event = rpc::event::FETCH_COLLECTIONS_SCHEMA;
 		logInfo("Fetching schemas required...");
 
+		obsManager()->attachScenes();
+		obsManager()->attachSources();
+
 		if(!checkResource(&data, QRegExp("(.+)"))) {
 			// This streamdeck doesn't provide any resource to warn on stream state change
 			logError("Streamdeck didn't provide resourceId to subscribe.");
@@ -285,9 +308,20 @@ CollectionsService::onFetchCollectionsSchema(const rpc::request& data) {
 
 	rpc::response<Collections> response2 = response_collections(&data, "onFetchCollectionsSchema");
 	response2.event = rpc::event::FETCH_COLLECTIONS_SCHEMA;
+#if defined(USE_SCHEMA)
 	response2.data = obsManager()->collections();
 
 	return streamdeckManager()->commit_to(response2, &StreamdeckManager::setSchema);
+#else
+	OBSManager* manager = obsManager();
+	return streamdeckManager()->commit_cached(
+		response2,
+		&StreamdeckManager::renderSchema,
+		0,
+		manager->version(),
+		[manager]() { return manager->collections(); }
+	);
+#endif
 }
 
 bool
@@ -302,8 +336,14 @@ CollectionsService::onGetCollections(const rpc::request& data) {
 			logWarning("Unknown resource for getCollections.");
 		}
 
-		response.data = obsManager()->collections();
-		return streamdeckManager()->commit_to(response, &StreamdeckManager::setCollections);
+		OBSManager* manager = obsManager();
+		return streamdeckManager()->commit_cached(
+			response,
+			&StreamdeckManager::renderCollections,
+			0,
+			manager->version(),
+			[manager]() { return manager->collections(); }
+		);
 	}
 
 	logError("GetCollections not called by GET_COLLECTIONS.");
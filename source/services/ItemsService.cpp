@@ -45,8 +45,10 @@ ItemsService::~ItemsService() {
 
 bool
 ItemsService::onItemsReordered(const obs::item::data& data) {
-	data.scene->synchronize();
-	return true;
+	// Only the order changed, nothing is bound again
+	if(!data.scene->reorder())
+		return true;
+	return streamdeckManager()->commit_deltas(data.scene->collection());
 }
 
 bool
@@ -67,10 +69,12 @@ ItemsService::onItemAdded(const obs::item::data& data) {
 
 	obsManager()->registerItem(item);
 
+	streamdeckManager()->commit_deltas(item->scene()->collection());
+
 	rpc::response<void> response = response_void(nullptr, "onItemAdded");
 	response.event = rpc::event::ITEM_ADDED_SUBSCRIBE;
 
-	return streamdeckManager()->commit_all(response, &StreamdeckManager::setEvent);
+	return streamdeckManager()->commit_coalesced(response);
 }
 
 bool
@@ -91,10 +95,12 @@ ItemsService::onItemRemoved(const obs::item::data& data) {
 
 	obsManager()->unregisterItem(item_ptr.get());
 
+	streamdeckManager()->commit_deltas(data.scene->collection());
+
 	rpc::response<void> response = response_void(nullptr, "onItemRemoved");
 	response.event = rpc::event::ITEM_REMOVED_SUBSCRIBE;
 
-	return streamdeckManager()->commit_all(response, &StreamdeckManager::setEvent);
+	return streamdeckManager()->commit_coalesced(response);
 }
 
 bool
@@ -122,10 +128,12 @@ ItemsService::onItemUpdated(const obs::item::data& data) {
 			break;
 	}
 
+	streamdeckManager()->commit_deltas(data.scene->collection());
+
 	rpc::response<void> response = response_void(nullptr, "onItemUpdated");
 	response.event = rpc::event::ITEM_UPDATED_SUBSCRIBE;
 
-	return streamdeckManager()->commit_all(response, &StreamdeckManager::setEvent);
+	return streamdeckManager()->commit_coalesced(response);
 }
 
 /*
@@ -144,6 +152,9 @@ ItemsService::subscribeItemChange(const rpc::request& data) {
 		response.event = data.event;
 		logInfo("Subscription to item event required");
 
+		// Item signals come from their scene
+		obsManager()->attachScenes();
+
 		if(!checkResource(&data, QRegExp("(.+)"))) {
 			// This streamdeck doesn't provide any resource to warn on stream state change
 			logError("Streamdeck didn't provide resourceId to subscribe.");
@@ -211,6 +222,9 @@ ItemsService::onItemChangeVisibility(const rpc::request& data) {
 			goto send_message;
 		}
 
+		// Its state must be current before it is toggled
+		obsManager()->attachScene(scene);
+
 		Item* item = scene->getItemById(item_id);
 
 		if(item == nullptr) {
@@ -234,6 +248,12 @@ ItemsService::onItemChangeVisibility(const rpc::request& data) {
 		}
 		else
 			response.data.error_flag = false;
+
+		// OBS signals of the batch were ignored, subscribers get a single update
+		streamdeckManager()->commit_deltas(scene->collection());
+		rpc::response<void> updated = response_void(nullptr, "onItemChangeVisibility");
+		updated.event = rpc::event::ITEM_UPDATED_SUBSCRIBE;
+		streamdeckManager()->commit_coalesced(updated);
 	}
 	else
 		logError("visibilityItem not called by VISIBILITY_ITEM");
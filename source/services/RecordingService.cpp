@@ -215,7 +215,7 @@ RecordingService::onRecordStarting(void* recordingService, calldata_t* data) {
 	rpc::response<std::string> response = service->response_string(nullptr, "onRecordingStarting");
 	response.event = rpc::event::RECORDING_STATUS_CHANGED_SUBSCRIBE;
 	response.data = "recording";
-	service->streamdeckManager()->commit_all(response, &StreamdeckManager::setEvent);
+	service->streamdeckManager()->commit_all(response, &StreamdeckManager::renderEvent);
 
 	rpc::response<rpc::response_error> action = service->response_error(nullptr, "onRecordingStarting");
 	action.event = rpc::event::START_RECORDING;
@@ -239,7 +239,7 @@ RecordingService::onRecordStarted(void* recording_service, calldata_t* data) {
 	rpc::response<std::string> response = service->response_string(nullptr, "onRecordingStarted");
 	response.event = rpc::event::RECORDING_STATUS_CHANGED_SUBSCRIBE;
 	response.data = "starting";
-	service->streamdeckManager()->commit_all(response, &StreamdeckManager::setEvent);
+	service->streamdeckManager()->commit_all(response, &StreamdeckManager::renderEvent);
 }
 
 bool
@@ -258,7 +258,7 @@ RecordingService::onRecordStopping(void* recording_service, calldata_t* data) {
 	rpc::response<std::string> response = service->response_string(nullptr, "onRecordingStopping");
 	response.event = rpc::event::RECORDING_STATUS_CHANGED_SUBSCRIBE;
 	response.data = "stopping";
-	service->streamdeckManager()->commit_all(response, &StreamdeckManager::setEvent);
+	service->streamdeckManager()->commit_all(response, &StreamdeckManager::renderEvent);
 }
 
 bool
@@ -282,7 +282,7 @@ RecordingService::onRecordStopped(void* recording_service, calldata_t* data) {
 	rpc::response<std::string> response = service->response_string(nullptr, "onRecordingStopped");
 	response.event = rpc::event::RECORDING_STATUS_CHANGED_SUBSCRIBE;
 	response.data = "offline";
-	service->streamdeckManager()->commit_all(response, &StreamdeckManager::setEvent);
+	service->streamdeckManager()->commit_all(response, &StreamdeckManager::renderEvent);
 
 	rpc::response<rpc::response_error> action = service->response_error(nullptr, "onRecordingStopped");
 	if(code == 0) {
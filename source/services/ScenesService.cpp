@@ -37,6 +37,10 @@ ScenesService::ScenesService() :
 	this->setupEvent(rpc::event::GET_ACTIVE_SCENE, &ScenesService::onGetActiveScene);
 
 	this->setupEvent(rpc::event::MAKE_SCENE_ACTIVE, &ScenesService::onMakeSceneActive);
+
+	this->setupEvent(rpc::event::DELTAS_SUBSCRIBE, &ScenesService::subscribeDeltas);
+
+	this->setupEvent(rpc::event::ACKNOWLEDGE_REVISION, &ScenesService::onAcknowledgeRevision);
 }
 
 ScenesService::~ScenesService() {
@@ -73,22 +77,26 @@ ScenesService::onSceneEvent(const obs::scene::data& data) {
 	if(obsManager()->isLoadingCollection() || obsManager()->activeCollection() == nullptr)
 		return true;
 
+	bool result = true;
 	switch(data.event) {
 		case obs::scene::event::ADDED:
-			return onSceneAdded(*obsManager()->activeCollection()->addScene(data.obs_source));
+			result = onSceneAdded(*obsManager()->activeCollection()->addScene(data.obs_source));
 			break;
 		case obs::scene::event::REMOVED:
-			return onSceneRemoved(*obsManager()->activeCollection()->removeScene(*data.scene).get());
+			result = onSceneRemoved(*obsManager()->activeCollection()->removeScene(*data.scene).get());
 			break;
 		case obs::scene::event::RENAMED:
-			return onSceneUpdated(
+			result = onSceneUpdated(
 				*obsManager()->activeCollection()->renameScene(*data.scene, data.name).get()
 			);
 			break;
 		default:
 			break;
 	}
-	return true;
+
+	// Each signal is applied on its own, a full rescan only runs every few changes
+	obsManager()->activeCollection()->checkScenes();
+	return result;
 }
 
 bool
@@ -123,7 +131,7 @@ ScenesService::onSceneSwitched() {
 	response.event = rpc::event::SCENE_SWITCHED_SUBSCRIBE;
 	response.data = scene;
 
-	return activ && streamdeckManager()->commit_all(response, &StreamdeckManager::setEvent);
+	return activ && streamdeckManager()->commit_all(response, &StreamdeckManager::renderEvent);
 }
 
 bool
@@ -136,10 +144,12 @@ ScenesService::onSceneAdded(const Scene& scene) {
 
 	obsManager()->registerScene(&scene);
 
+	streamdeckManager()->commit_deltas(scene.collection());
+
 	rpc::response<void> response = response_void(nullptr, "onSceneAdded");
 	response.event = rpc::event::SCENE_ADDED_SUBSCRIBE;
 
-	return streamdeckManager()->commit_all(response, &StreamdeckManager::setEvent);
+	return streamdeckManager()->commit_coalesced(response);
 }
 
 bool
@@ -152,16 +162,20 @@ ScenesService::onSceneRemoved(const Scene& scene) {
 
 	obsManager()->unregisterScene(&scene);
 
+	streamdeckManager()->commit_deltas(scene.collection());
+
 	rpc::response<void> response = response_void(nullptr, "onSceneRemoved");
 	response.event = rpc::event::SCENE_REMOVED_SUBSCRIBE;
 
-	return streamdeckManager()->commit_all(response, &StreamdeckManager::setEvent);
+	return streamdeckManager()->commit_coalesced(response);
 }
 
 bool
 ScenesService::onSceneUpdated(const Scene& scene) {
 	logInfo(QString("Scene renamed to %1").arg(scene.name().c_str()).toStdString());
 
+	streamdeckManager()->commit_deltas(scene.collection());
+
 	// The RPC protocol doesn't provide any resource for handling scene renaming.
 	// We can use both scene removed/scene added to handle that, but each of them
 	// implies GET_SCENES message. Then we send directly the GET_SCENES message instead.
@@ -172,13 +186,13 @@ ScenesService::onSceneUpdated(const Scene& scene) {
 	Collection* collection = scene.collection();
 	response.data = collection->scenes();
 
-	return streamdeckManager()->commit_all(response, &StreamdeckManager::setScenes);
+	return streamdeckManager()->commit_all(response, &StreamdeckManager::renderScenes);
 #else
 	Collections collections = obsManager()->collections();
 	bool result = true;
 	for(auto iter = collections.begin(); iter < collections.end() && result; iter++) {
 		response.data = (*iter)->scenes();
-		result &= streamdeckManager()->commit_all(response, &StreamdeckManager::setScenes);
+		result &= streamdeckManager()->commit_all(response, &StreamdeckManager::renderScenes);
 	}
 	return result;
 #endif
@@ -200,6 +214,9 @@ ScenesService::subscribeSceneChange(const rpc::request& data) {
 		response.event = data.event;
 		logInfo("Subscription to scene event required");
 
+		// Cached states are only reliable once the scenes signal handlers are attached
+		obsManager()->attachScenes();
+
 		if(!checkResource(&data, QRegExp("(.+)"))) {
 			// This streamdeck doesn't provide any resource to warn on stream state change
 			logError("Streamdeck didn't provide resourceId to subscribe.");
@@ -227,6 +244,8 @@ ScenesService::onGetScenes(const rpc::request& data) {
 		response.event = rpc::event::GET_SCENES;
 		logInfo("Scenes list required.");
 
+		obsManager()->attachScenes();
+
 		if(!checkResource(&data, QRegExp("getScenes"))) {
 			logWarning("Unknown resource for getScenes.");
 		}
@@ -255,10 +274,16 @@ ScenesService::onGetScenes(const rpc::request& data) {
 			collection = obsManager()->collection(id);
 		}
 
-		if(collection != nullptr)
-			response.data = collection->scenes();
+		if(collection == nullptr)
+			return streamdeckManager()->commit_to(response, &StreamdeckManager::setScenes);
 
-		return streamdeckManager()->commit_to(response, &StreamdeckManager::setScenes);
+		return streamdeckManager()->commit_cached(
+			response,
+			&StreamdeckManager::renderScenes,
+			collection->id(),
+			collection->version(),
+			[collection]() { return collection->scenes(); }
+		);
 	}
 
 	logError("getScenes not called by GET_SCENES");
@@ -323,7 +348,7 @@ ScenesService::onMakeSceneActive(const rpc::request& data) {
 			response_switch.data = obsManager()->activeCollection()->activeScene();
 
 			return streamdeckManager()->commit_to(response, &StreamdeckManager::setResult) &&
-				streamdeckManager()->commit_all(response_switch, &StreamdeckManager::setEvent);
+				streamdeckManager()->commit_all(response_switch, &StreamdeckManager::renderEvent);
 		}
 		
 		return streamdeckManager()->commit_to(response, &StreamdeckManager::setResult);
@@ -331,4 +356,62 @@ ScenesService::onMakeSceneActive(const rpc::request& data) {
 
 	logError("MakeSceneActive not called by MAKE_SCENE_ACTIVE.");
 	return false;
+}
+
+bool
+ScenesService::subscribeDeltas(const rpc::request& data) {
+	rpc::response<CollectionPtr> response = response_collection(&data, "subscribeDeltas");
+	if(data.event == rpc::event::DELTAS_SUBSCRIBE) {
+		response.event = rpc::event::DELTAS_SUBSCRIBE;
+		logInfo("Subscription to deltas required");
+
+		// Deltas cover the whole model
+		obsManager()->attachScenes();
+		obsManager()->attachSources();
+
+		if(!checkResource(&data, QRegExp("(.+)"))) {
+			logError("Streamdeck didn't provide resourceId to subscribe.");
+			return false;
+		}
+
+		// Without any collection provided, the client follows the active collection
+		Collection* collection = obsManager()->activeCollection();
+		if(data.args.size() > 0 && data.args[0].compare("") != 0) {
+			uint16_t id = QString(data.args[0].toString()).toShort();
+			response.data = obsManager()->collection(id);
+			if(response.data == nullptr) {
+				logError("Unknown collection for deltas subscription.");
+				return false;
+			}
+			collection = response.data;
+		}
+
+		// The first delta is a snapshot of the collection
+		return streamdeckManager()->commit_to(response, &StreamdeckManager::setDeltaSubscription) &&
+			streamdeckManager()->commit_deltas(collection, data.client);
+	}
+
+	logError("subscribeDeltas not called by DELTAS_SUBSCRIBE");
+	return false;
+}
+
+bool
+ScenesService::onAcknowledgeRevision(const rpc::request& data) {
+	rpc::response<Revision> response = response_revision(&data, "onAcknowledgeRevision");
+	if(data.event == rpc::event::ACKNOWLEDGE_REVISION) {
+		response.event = rpc::event::ACKNOWLEDGE_REVISION;
+
+		if(data.args.size() < 2) {
+			logError("No revision provided by acknowledgeRevision.");
+			return false;
+		}
+
+		response.data.collection = QString(data.args[0].toString()).toShort();
+		response.data.revision = QString(data.args[1].toString()).toULongLong();
+
+		return streamdeckManager()->commit_to(response, &StreamdeckManager::setRevision);
+	}
+
+	logError("onAcknowledgeRevision not called by ACKNOWLEDGE_REVISION");
+	return false;
 }
\ No newline at end of file
@@ -70,10 +70,12 @@ SourcesService::onSourceAdded(const obs::source::data& data) {
 		.toStdString()
 	);
 
+	streamdeckManager()->commit_deltas(obsManager()->activeCollection());
+
 	rpc::response<void> response = response_void(nullptr, "onSourceAdded");
 	response.event = rpc::event::SOURCE_ADDED_SUBSCRIBE;
 
-	return streamdeckManager()->commit_all(response, &StreamdeckManager::setEvent);
+	return streamdeckManager()->commit_coalesced(response);
 }
 
 bool
@@ -96,10 +98,12 @@ SourcesService::onSourceRemoved(const obs::source::data& data) {
 		.toStdString()
 	);
 
+	streamdeckManager()->commit_deltas(obsManager()->activeCollection());
+
 	rpc::response<void> response = response_void(nullptr, "onSourceRemoved");
 	response.event = rpc::event::SOURCE_REMOVED_SUBSCRIBE;
 
-	return streamdeckManager()->commit_all(response, &StreamdeckManager::setEvent);
+	return streamdeckManager()->commit_coalesced(response);
 }
 
 bool
@@ -122,10 +126,12 @@ SourcesService::onSourceRenamed(const obs::source::data& data) {
 
 	obsManager()->activeCollection()->renameSource(*data.source, data.data.string_value);
 
+	streamdeckManager()->commit_deltas(obsManager()->activeCollection());
+
 	rpc::response<void> response = response_void(nullptr, "onSourceRenamed");
 	response.event = rpc::event::SOURCE_UPDATED_SUBSCRIBE;
 
-	return streamdeckManager()->commit_all(response, &StreamdeckManager::setEvent);
+	return streamdeckManager()->commit_coalesced(response);
 }
 
 bool
@@ -155,10 +161,12 @@ SourcesService::onSourceMuted(const obs::source::data& data) {
 		);
 	}
 
+	streamdeckManager()->commit_deltas(obsManager()->activeCollection());
+
 	rpc::response<void> response = response_void(nullptr, "onSourceMuted");
 	response.event = rpc::event::SOURCE_UPDATED_SUBSCRIBE;
 
-	return streamdeckManager()->commit_all(response, &StreamdeckManager::setEvent);
+	return streamdeckManager()->commit_coalesced(response);
 }
 
 bool
@@ -188,10 +196,12 @@ SourcesService::onSourceFlagsChanged(const obs::source::data& data) {
 		);
 	}
 
+	streamdeckManager()->commit_deltas(obsManager()->activeCollection());
+
 	rpc::response<void> response = response_void(nullptr, "onSourceFlags");
 	response.event = rpc::event::SOURCE_UPDATED_SUBSCRIBE;
 
-	return streamdeckManager()->commit_all(response, &StreamdeckManager::setEvent);
+	return streamdeckManager()->commit_coalesced(response);
 }
 
 /*
@@ -210,6 +220,8 @@ SourcesService::subscribeSourceChange(const rpc::request& data) {
 		response.event = data.event;
 		logInfo("Subscription to source event required");
 
+		obsManager()->attachSources();
+
 		if(!checkResource(&data, QRegExp("(.+)"))) {
 			// This streamdeck doesn't provide any resource to warn on stream state change
 			logError("Streamdeck didn't provide resourceId to subscribe.");
@@ -237,6 +249,8 @@ SourcesService::onGetSources(const rpc::request& data) {
 		response.event = rpc::event::GET_SOURCES;
 		logInfo("Sources list required.");
 
+		obsManager()->attachSources();
+
 		if(!checkResource(&data, QRegExp("getSources"))) {
 			logWarning("Unknown resource for getSources.");
 		}
@@ -265,10 +279,16 @@ SourcesService::onGetSources(const rpc::request& data) {
 			collection = obsManager()->collection(id);
 		}
 
-		if(collection != nullptr)
-			response.data = collection->sources();
+		if(collection == nullptr)
+			return streamdeckManager()->commit_to(response, &StreamdeckManager::setSources);
 
-		return streamdeckManager()->commit_to(response, &StreamdeckManager::setSources);
+		return streamdeckManager()->commit_cached(
+			response,
+			&StreamdeckManager::renderSources,
+			collection->id(),
+			collection->version(),
+			[collection]() { return collection->sources(); }
+		);
 	}
 
 	logError("getScenes not called by GET_SOURCES");
@@ -306,13 +326,16 @@ SourcesService::onMuteSource(const rpc::request& data) {
 			logError(response.data.error_message);
 		}
 		else {
+			// Its state must be current before it is toggled
 			Source* source = nullptr;
 			if(flag == 2) {
 				Scene* scene = obsManager()->activeCollection()->getSceneById(source_id);
+				obsManager()->attachScene(scene);
 				if(scene != nullptr) source = &scene->sourcedScene();
 			}
 			else if(flag == 1) {
 				source = obsManager()->activeCollection()->getSourceById(source_id);
+				obsManager()->attachSource(source);
 			}
 			if(source == nullptr) {
 				response.data.hasMessage = true;
@@ -230,7 +230,7 @@ StreamingService::onStreamStarting(void* streaming_service, calldata_t* data) {
 	rpc::response<std::string> response = service->response_string(nullptr, "onStreamingStarting");
 	response.event = rpc::event::STREAMING_STATUS_CHANGED_SUBSCRIBE;
 	response.data = "starting";
-	service->streamdeckManager()->commit_all(response, &StreamdeckManager::setEvent);
+	service->streamdeckManager()->commit_all(response, &StreamdeckManager::renderEvent);
 }
 
 bool
@@ -249,7 +249,7 @@ StreamingService::onStreamStarted(void* streaming_service, calldata_t* data) {
 	rpc::response<std::string> response = service->response_string(nullptr, "onStreamingStarted");
 	response.event = rpc::event::STREAMING_STATUS_CHANGED_SUBSCRIBE;
 	response.data = "live";
-	service->streamdeckManager()->commit_all(response, &StreamdeckManager::setEvent);
+	service->streamdeckManager()->commit_all(response, &StreamdeckManager::renderEvent);
 
 	rpc::response<rpc::response_error> action = service->response_error(nullptr, "onStreamingStarted");
 	action.event = rpc::event::START_STREAMING;
@@ -273,7 +273,7 @@ StreamingService::onStreamStopping(void* streaming_service, calldata_t* data) {
 	rpc::response<std::string> response = service->response_string(nullptr, "onStreamingStopping");
 	response.event = rpc::event::STREAMING_STATUS_CHANGED_SUBSCRIBE;
 	response.data = "ending";
-	service->streamdeckManager()->commit_all(response, &StreamdeckManager::setEvent);
+	service->streamdeckManager()->commit_all(response, &StreamdeckManager::renderEvent);
 }
 
 bool
@@ -297,7 +297,7 @@ StreamingService::onStreamStopped(void* streaming_service, calldata_t* data) {
 	rpc::response<std::string> response = service->response_string(nullptr, "onStreamingStopped");
 	response.event = rpc::event::STREAMING_STATUS_CHANGED_SUBSCRIBE;
 	response.data = "offline";
-	service->streamdeckManager()->commit_all(response, &StreamdeckManager::setEvent);
+	service->streamdeckManager()->commit_all(response, &StreamdeckManager::renderEvent);
 
 	rpc::response<rpc::response_error> action = service->response_error(nullptr, "onStreamingStopped");
 	if(code == 0) {
@@ -324,7 +324,7 @@ StreamingService::onStreamReconnecting(void* streaming_service, calldata_t* data
 	);
 	response.event = rpc::event::STREAMING_STATUS_CHANGED_SUBSCRIBE;
 	response.data = "reconnecting";
-	service->streamdeckManager()->commit_all(response, &StreamdeckManager::setEvent);
+	service->streamdeckManager()->commit_all(response, &StreamdeckManager::renderEvent);
 }
 
 void
@@ -340,5 +340,5 @@ StreamingService::onStreamReconnected(void* streaming_service, calldata_t* data)
 	);
 	response.event = rpc::event::STREAMING_STATUS_CHANGED_SUBSCRIBE;
 	response.data = "live";
-	service->streamdeckManager()->commit_all(response, &StreamdeckManager::setEvent);
+	service->streamdeckManager()->commit_all(response, &StreamdeckManager::renderEvent);
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 /*
  * CRT Includes
  */
+#include <algorithm>
 #include <cstdlib>
 #include <cmath>
 
@@ -16,7 +17,6 @@
  */
 #include "include/Global.h"
 #include "include/streamdeck/Streamdeck.hpp"
-#include "include/common/SharedVariablesManager.hpp"
 #include "include/common/Logger.hpp"
 
 /*
@@ -35,16 +35,42 @@ extern std::string ptr_to_string(void* ptr);
 
 bool StreamdeckClient::_is_verbose = false;
 
+std::atomic<qint64> StreamdeckClient::_high_watermark(STREAMDECK_HIGH_WATERMARK);
+
+std::atomic<qint64> StreamdeckClient::_low_watermark(STREAMDECK_LOW_WATERMARK);
+
+std::atomic<qint64> StreamdeckClient::_max_pending(STREAMDECK_MAX_PENDING);
+
 /*
 ========================================================================================================
 	Constructor / Destructors
 ========================================================================================================
 */
 
-StreamdeckClient::StreamdeckClient(qintptr socket_descriptor) :
+StreamdeckReactor::StreamdeckReactor(QObject* parent) :
+	QThread(parent),
+	m_clients(0),
+	m_context(new QObject()) {
+	m_context->moveToThread(this);
+}
+
+StreamdeckReactor::~StreamdeckReactor() {
+	stop();
+	delete m_context;
+	log_custom(LOG_STREAMDECK_CLIENT) << "[Streamdeck Reactor] Stopped." << log_end;
+}
+
+StreamdeckClient::StreamdeckClient(qintptr socket_descriptor, StreamdeckReactor* reactor) :
 	m_socketDescriptor(socket_descriptor),
-	m_startExecution(false) {
+	m_reactor(reactor),
+	m_connected(false),
+	m_outboundBytes(0),
+	m_queueDepth(0),
+	m_bytesPending(0) {
 	m_internalSocket = nullptr;
+	m_reactor->m_clients++;
+	std::lock_guard<std::mutex> lock(m_reactor->m_membersLock);
+	m_reactor->m_members.insert(this);
 }
 
 StreamdeckClient::~StreamdeckClient() {
@@ -54,19 +80,29 @@ StreamdeckClient::~StreamdeckClient() {
 		m_internalSocket->deleteLater();
 		m_internalSocket = nullptr;
 	}
+	m_reactor->m_clients--;
+	{
+		std::lock_guard<std::mutex> lock(m_reactor->m_membersLock);
+		m_reactor->m_members.erase(this);
+	}
 	log_custom(LOG_STREAMDECK_CLIENT) << "[Streamdeck Client] Destroyed." << log_end;
 }
 
 Streamdeck::Streamdeck(StreamdeckClient& client) :
-	m_internalClient(client) {
+	m_internalClient(client),
+	m_deltaMode(false),
+	m_deltaCollection(0),
+	m_acknowledgedRevision{ 0, 0 } {
 	connect(&m_internalClient, SIGNAL(disconnected(int)), this, SLOT(disconnected(int)));
-	connect(&m_internalClient, SIGNAL(read(QJsonDocument)), this, SLOT(read(QJsonDocument)));
-	connect(this, SIGNAL(write(QJsonDocument)), &m_internalClient, SLOT(write(QJsonDocument)), 
+	connect(&m_internalClient, SIGNAL(read(rpc::message)), this, SLOT(read(rpc::message)));
+	connect(this, SIGNAL(write(rpc::batch)), &m_internalClient, SLOT(write(rpc::batch)),
 		Qt::ConnectionType::QueuedConnection);
 	connect(this, &Streamdeck::close_client, &m_internalClient, &StreamdeckClient::close);
 
 	memset((byte*)m_authorizedEvents, 0xFF, sizeof(m_authorizedEvents));
 
+	m_output.reserve(RPC_FRAME_BUFFER_SIZE);
+
 	setEventAuthorizations(rpc::event::START_STREAMING, EVENT_READ);
 	setEventAuthorizations(rpc::event::STOP_STREAMING, EVENT_READ);
 	setEventAuthorizations(rpc::event::START_RECORDING, EVENT_READ);
@@ -78,62 +114,89 @@ Streamdeck::~Streamdeck() {
 
 	log_custom(LOG_STREAMDECK) << "[Streamdeck] Destruction..." << log_end;
 
-	if(m_internalClient.isRunning()) {
-		m_internalClient.exit(0);
-	}
-
 	disconnect(&m_internalClient, SIGNAL(disconnected(int)), this, SLOT(disconnected(int)));
-	disconnect(&m_internalClient, SIGNAL(read(QJsonDocument)), this, SLOT(read(QJsonDocument)));
-	disconnect(this, SIGNAL(write(QJsonDocument)), &m_internalClient, SLOT(write(QJsonDocument)));
+	disconnect(&m_internalClient, SIGNAL(read(rpc::message)), this, SLOT(read(rpc::message)));
+	disconnect(this, SIGNAL(write(rpc::batch)), &m_internalClient, SLOT(write(rpc::batch)));
 	disconnect(this, &Streamdeck::close_client, &m_internalClient, &StreamdeckClient::close);
 
-	delete &m_internalClient;
+	// The client belongs to its reactor thread, it must be destroyed by its own event loop
+	m_internalClient.deleteLater();
 }
 
 /*
 ========================================================================================================
-	Thread Handling
+	Reactor Handling
 ========================================================================================================
 */
 
+int
+StreamdeckReactor::load() const {
+	return m_clients;
+}
+
 void
-StreamdeckClient::run() {
+StreamdeckReactor::stop() {
+	if(!isRunning())
+		return;
 
-	log_custom(LOG_STREAMDECK_CLIENT) << "[Streamdeck Client] New thread run." << log_end;
+	// Clients are closed and destroyed by the reactor thread before its loop quits, nothing they
+	// posted before is lost, and no deletion is left pending on a dead thread
+	QMetaObject::invokeMethod(m_context, [this]() {
+		std::set<StreamdeckClient*> members;
+		{
+			std::lock_guard<std::mutex> lock(m_membersLock);
+			members = m_members;
+		}
+		for(auto iter = members.begin(); iter != members.end(); iter++) {
+			(*iter)->close();
+			delete *iter;
+		}
+	}, Qt::BlockingQueuedConnection);
 
-	bool_s ready = shared_variable<bool>("ready");
-	bool_s socket_created = shared_variable<bool>("socket_created");
+	quit();
+	wait();
+}
 
-	ready.wait([](const bool& value){ return value == true; });
+void
+StreamdeckClient::open() {
+
+	log_custom(LOG_STREAMDECK_CLIENT) << "[Streamdeck Client] Opening socket on reactor." << log_end;
 
 	m_internalSocket = new QTcpSocket(this);
 
 	if(!m_internalSocket->setSocketDescriptor(m_socketDescriptor)) {
+		log_error << QString("[Streamdeck Client] Socket %1 could not be opened : %2.")
+			.arg(m_socketDescriptor)
+			.arg(m_internalSocket->errorString())
+			.toStdString() << log_end;
 		m_internalSocket->close();
 		m_internalSocket->deleteLater();
 		m_internalSocket = nullptr;
 		m_socketDescriptor = -1;
 	}
 
-	log_custom(LOG_STREAMDECK_CLIENT) << "[Streamdeck Client] Socket created." << log_end;
-
 	if(m_internalSocket != nullptr) {
+		log_custom(LOG_STREAMDECK_CLIENT) << "[Streamdeck Client] Socket created." << log_end;
 		connect(m_internalSocket, SIGNAL(disconnected(void)), this, SLOT(disconnected(void)));
-		connect(m_internalSocket, SIGNAL(readyRead(void)), this, SLOT(read(void)));
+		connect(m_internalSocket, SIGNAL(bytesWritten(qint64)), this, SLOT(written(qint64)));
+		m_connected = true;
 	}
 
-	socket_created = true;
+	// The server is notified through a queued signal, no thread waits for the socket
+	emit opened(this, m_internalSocket != nullptr);
+}
 
-	if(m_internalSocket == nullptr) 
+void
+StreamdeckClient::start() {
+	if(m_internalSocket == nullptr)
 		return;
 
-	while(!m_startExecution);
-
-	/*****************************/
-	//        EVENT LOOP         //
-	///////////////////////////////
-	exec();
-	/****************************/
+	// Messages are only dispatched once the streamdeck is bound to this client. Bytes received
+	// in the meantime stay in the socket buffer and are drained right now.
+	connect(m_internalSocket, SIGNAL(readyRead(void)), this, SLOT(read(void)));
+	log_custom(LOG_STREAMDECK_CLIENT) << QString("[Streamdeck Client] Ready %1ms after accept.")
+		.arg(m_acceptTimer.elapsed()).toStdString() << log_end;
+	read();
 }
 
 /*
@@ -193,6 +256,148 @@ Streamdeck::addToJsonArray(QJsonValueRef&& json_array, QJsonValue&& value) {
 	}
 }
 
+void
+Streamdeck::writeItems(
+	rpc::json_writer<QByteArray>& json,
+	const char* key,
+	uint64_t collection_id,
+	bool active,
+	const SceneNode& scene
+) {
+	json.key(key).beginArray();
+
+	for(auto iter_it = scene.items.begin(); iter_it < scene.items.end(); iter_it++) {
+		uint64_t item_id = /* type << 8 */ + iter_it->id;
+		uint64_t source_id = (collection_id << 18) + iter_it->source;
+
+		json.beginObject();
+		json.field("sceneItemId", (int32_t)item_id);
+		json.field("sceneNodeType", iter_it->type);
+		json.key("sourceId").quoted(source_id);
+		json.field("visible", active && iter_it->visible);
+		json.endObject();
+	}
+
+	json.endArray();
+}
+
+void
+Streamdeck::writeScene(
+	rpc::json_writer<QByteArray>& json,
+	uint64_t collection_id,
+	bool active,
+	const SceneNode& scene
+) {
+	uint64_t scene_id = (collection_id << 18) + scene.id;
+
+	json.beginObject();
+	json.key("id").quoted(scene_id);
+#ifndef NO_SEND_ITEMS
+	bool as_nodes = (std::rand() % 2) == 0;
+	if(!as_nodes)
+		writeItems(json, "items", collection_id, active, scene);
+	json.field("name", scene.name);
+	if(as_nodes)
+		writeItems(json, "nodes", collection_id, active, scene);
+#else
+	json.field("name", scene.name);
+#endif
+	json.endObject();
+}
+
+void
+Streamdeck::writeSource(
+	rpc::json_writer<QByteArray>& json,
+	uint64_t collection_id,
+	bool active,
+	const SourceNode& source
+) {
+	uint64_t source_id = (collection_id << 18) + source.key;
+
+	json.beginObject();
+	json.field("audio", source.audio);
+	json.key("id").quoted(source_id);
+	json.field("muted", active && source.muted);
+	json.field("name", source.name);
+	json.field("type", source.type);
+	json.endObject();
+}
+
+rpc::frame
+Streamdeck::renderEvent() {
+	QJsonObject response = buildJsonResult(rpc::event::NO_EVENT, "");
+
+	// resourceId is the last key of the last object, its value is spliced before the final "}}
+	QByteArray bytes = QJsonDocument(response).toJson(QJsonDocument::JsonFormat::Compact).append('\n');
+
+	// Without payload, a newer notification makes the pending ones useless
+	return rpc::frame(bytes, bytes.size() - 4, true);
+}
+
+rpc::frame
+Streamdeck::renderDelta(const Delta& delta, const Snapshot& snapshot) {
+	// Nothing changed since the acknowledged revision
+	if(!delta.snapshot && delta.scenes.empty() && delta.sources.empty() &&
+		delta.removedScenes.empty() && delta.removedSources.empty()) {
+		return rpc::frame();
+	}
+
+	QByteArray bytes;
+	rpc::json_writer<QByteArray> json(bytes);
+	uint64_t collection_id = delta.collection != nullptr ? delta.collection->id() : snapshot.collection;
+
+	// Keys are written in the order QJsonDocument sorts them
+	json.beginObject();
+	json.field("id", (int32_t)rpc::event::NO_EVENT);
+	json.field("jsonrpc", "2.0");
+	json.key("result").beginObject();
+	json.field("_type", "EVENT");
+	json.key("data").beginObject();
+	json.key("collection").quoted(collection_id);
+	json.key("from").quoted(delta.from);
+	json.key("removedScenes").beginArray();
+	for(auto iter = delta.removedScenes.begin(); iter < delta.removedScenes.end(); iter++)
+		json.quoted((collection_id << 18) + *iter);
+	json.endArray();
+	json.key("removedSources").beginArray();
+	for(auto iter = delta.removedSources.begin(); iter < delta.removedSources.end(); iter++)
+		json.quoted((collection_id << 18) + *iter);
+	json.endArray();
+	json.key("revision").quoted(delta.revision);
+	json.key("scenes").beginArray();
+	for(auto iter = delta.scenes.begin(); iter < delta.scenes.end(); iter++) {
+		auto node = std::lower_bound(snapshot.scenes.begin(), snapshot.scenes.end(), *iter,
+			[](const SceneNodePtr& scene, uint16_t id) { return scene->id < id; });
+		if(node != snapshot.scenes.end() && (*node)->id == *iter)
+			writeScene(json, collection_id, snapshot.active, **node);
+	}
+	json.endArray();
+	json.field("snapshot", delta.snapshot);
+	json.key("sources").beginArray();
+	for(auto iter = delta.sources.begin(); iter < delta.sources.end(); iter++) {
+		auto node = std::lower_bound(snapshot.sources.begin(), snapshot.sources.end(), *iter,
+			[](const SourceNodePtr& source, uint32_t key) { return source->key < key; });
+		if(node != snapshot.sources.end() && (*node)->key == *iter)
+			writeSource(json, collection_id, snapshot.active, **node);
+	}
+	json.endArray();
+	json.endObject();
+	json.field("resourceId", "");
+	json.endObject();
+	json.endObject();
+	json.endLine();
+
+	// resourceId is the last key of the last object, its value is spliced before the final "}}
+	return rpc::frame(bytes, bytes.size() - 4, true, collection_id);
+}
+
+QByteArray&
+Streamdeck::outputBuffer() {
+	// The buffer keeps its capacity between responses unless a previous one is still queued
+	m_output.resize(0);
+	return m_output;
+}
+
 /*
 ========================================================================================================
 	RPC Protocol
@@ -337,7 +542,7 @@ Streamdeck::sendSchema(
 			addToJsonObject(scene, "name", QString::fromStdString((*iter_sc)->name()));
 
 			QJsonArray items_json;
-			Items items = (*iter_sc)->items();
+			Items items = (*iter_sc)->ordered();
 			for(auto iter_it = items.items.begin(); iter_it < items.items.end(); iter_it++) {
 				QJsonObject item;
 
@@ -392,27 +597,49 @@ Streamdeck::sendSchema(
 #endif
 }
 
-bool
-Streamdeck::sendCollections(
+void
+Streamdeck::renderCollections(
+	QByteArray& output,
 	const rpc::event event,
 	const std::string& resource,
 	const Collections& collections,
 	bool event_mode
 ) {
-	QJsonObject response = buildJsonResult(event, QString::fromStdString(resource), event_mode);
+	rpc::json_writer<QByteArray> json(output);
 
-	QJsonArray data;
+	// Keys are written in the order QJsonDocument sorts them
+	json.beginObject();
+	json.field("id", (int32_t)event);
+	json.field("jsonrpc", "2.0");
+	json.key("result").beginObject();
+	if(event == rpc::event::NO_EVENT || event_mode)
+		json.field("_type", "EVENT");
+	json.key("data").beginArray();
 	for(auto iter = collections.begin(); iter < collections.end(); iter++) {
-		QJsonObject collection;
-		addToJsonObject(collection, "name", (*iter)->name().c_str());
-		addToJsonObject(collection, "id", QString("%1").arg((*iter)->id()));
-		addToJsonArray(data, collection);
+		json.beginObject();
+		json.key("id").quoted((*iter)->id());
+		json.field("name", (*iter)->interned());
+		json.endObject();
 	}
-	addToJsonObject(response["result"], "data", data);
+	json.endArray();
+	json.field("resourceId", resource);
+	json.endObject();
+	json.endObject();
+	json.endLine();
+}
+
+bool
+Streamdeck::sendCollections(
+	const rpc::event event,
+	const std::string& resource,
+	const Collections& collections,
+	bool event_mode
+) {
+	renderCollections(outputBuffer(), event, resource, collections, event_mode);
 
 	log_custom(LOG_STREAMDECK) << QString("Send collections.").toStdString() << log_end;
 
-	send(event, QJsonDocument(response));
+	send(event, m_output);
 	return true;
 }
 
@@ -433,62 +660,56 @@ Streamdeck::sendCollection(
 	return true;
 }
 
-bool
-Streamdeck::sendScenes(
+void
+Streamdeck::renderScenes(
+	QByteArray& output,
 	const rpc::event event,
 	const std::string& resource,
 	const Scenes& scenes,
 	bool event_mode
 ) {
-	QJsonObject response = buildJsonResponse(event, QString::fromStdString(resource), event_mode);
-	QString collection_id = "";
-	if(scenes.collection != nullptr)
-		collection_id = QString("%1").arg(scenes.collection->id());
-	addToJsonObject(response, "collection", collection_id);
-
-	QJsonArray result;
-	for(auto iter_sc = scenes.scenes.begin(); iter_sc < scenes.scenes.end(); iter_sc++) {
-		Scene* scene_ptr = (*iter_sc);
-		QJsonObject scene;
-		uint64_t scene_id = scene_ptr->id();
-		if(scenes.collection != nullptr)
-			scene_id += (scenes.collection->id() << 18);
-		addToJsonObject(scene, "id", QString("%1").arg(scene_id));
-		addToJsonObject(scene, "name", QString::fromStdString(scene_ptr->name()));
-
-		QJsonArray nodes_items;
-		std::vector<ItemPtr> items = std::move(scene_ptr->items().items);
-		for(auto iter_it = items.begin(); iter_it < items.end(); iter_it++) {
-			Item* item_ptr = (*iter_it);
-			const Source* sourceRef = item_ptr->source();
-
-			// In this case, we are pending a deletion, but deletion is not completed by OBS
-			// We ignore the item
-			if(sourceRef == nullptr) {
-				continue;
-			}
-
-			QJsonObject item;
-			uint64_t item_id = /* type << 8 */ + item_ptr->id();
-			addToJsonObject(item, "sceneItemId", (int32_t)item_id);
-			short flag = sourceRef->registrable() ? 1 : 2;
-			uint64_t source_id = (sourceRef->collection()->id() << 18) + (flag << 16) + sourceRef->id();
-			addToJsonObject(item, "sourceId", QString("%1").arg(source_id));
-			addToJsonObject(item, "visible", item_ptr->visible());
-			addToJsonObject(item, "sceneNodeType", item_ptr->type());
+	rpc::json_writer<QByteArray> json(output);
+	// Serialized from the published snapshot, never from the live model
+	SnapshotPtr snapshot = scenes.collection != nullptr ? scenes.collection->snapshot() : nullptr;
 
-			addToJsonArray(nodes_items, item);
-		}
-#ifndef NO_SEND_ITEMS
-		addToJsonObject(scene, ((std::rand() % 2) == 0 ? "nodes" : "items"), nodes_items);
-#endif
-		addToJsonArray(result, scene);
+	// Keys are written in the order QJsonDocument sorts them
+	json.beginObject();
+	if(event == rpc::event::NO_EVENT || event_mode)
+		json.field("_type", "EVENT");
+	if(snapshot != nullptr)
+		json.key("collection").quoted(snapshot->collection);
+	else
+		json.field("collection", "");
+	json.field("id", (int32_t)event);
+	json.field("jsonrpc", "2.0");
+	json.field("resourceId", resource);
+
+	// Only the listed scenes are written, in the order of the list
+	json.key("result").beginArray();
+	for(auto iter_sc = scenes.scenes.begin(); snapshot != nullptr && iter_sc < scenes.scenes.end(); iter_sc++) {
+		uint16_t id = (*iter_sc)->id();
+		auto node = std::lower_bound(snapshot->scenes.begin(), snapshot->scenes.end(), id,
+			[](const SceneNodePtr& scene, uint16_t scene_id) { return scene->id < scene_id; });
+		if(node != snapshot->scenes.end() && (*node)->id == id)
+			writeScene(json, snapshot->collection, snapshot->active, **node);
 	}
-	addToJsonObject(response, "result", result);
+	json.endArray();
+	json.endObject();
+	json.endLine();
+}
+
+bool
+Streamdeck::sendScenes(
+	const rpc::event event,
+	const std::string& resource,
+	const Scenes& scenes,
+	bool event_mode
+) {
+	renderScenes(outputBuffer(), event, resource, scenes, event_mode);
 
 	log_custom(LOG_STREAMDECK) << QString("Send scenes.").toStdString() << log_end;
 
-	send(event, QJsonDocument(response));
+	send(event, m_output);
 	return true;
 }
 
@@ -510,6 +731,44 @@ Streamdeck::sendScene(
 	return true;
 }
 
+void
+Streamdeck::renderSources(
+	QByteArray& output,
+	const rpc::event event,
+	const std::string& resource,
+	const Sources& sources,
+	bool event_mode
+) {
+	rpc::json_writer<QByteArray> json(output);
+	// Serialized from the published snapshot, never from the live model
+	SnapshotPtr snapshot = sources.collection != nullptr ? sources.collection->snapshot() : nullptr;
+
+	// Keys are written in the order QJsonDocument sorts them
+	json.beginObject();
+	if(event == rpc::event::NO_EVENT || event_mode)
+		json.field("_type", "EVENT");
+	if(snapshot != nullptr)
+		json.key("collection").quoted(snapshot->collection);
+	else
+		json.field("collection", "");
+	json.field("id", (int32_t)event);
+	json.field("jsonrpc", "2.0");
+	json.field("resourceId", resource);
+
+	// Only the listed sources are written, in the order of the list
+	json.key("result").beginArray();
+	for(auto iter_src = sources.sources.begin(); snapshot != nullptr && iter_src < sources.sources.end(); iter_src++) {
+		uint32_t key = (((*iter_src)->registrable() ? 1 : 2) << 16) + (*iter_src)->id();
+		auto node = std::lower_bound(snapshot->sources.begin(), snapshot->sources.end(), key,
+			[](const SourceNodePtr& source, uint32_t source_key) { return source->key < source_key; });
+		if(node != snapshot->sources.end() && (*node)->key == key)
+			writeSource(json, snapshot->collection, snapshot->active, **node);
+	}
+	json.endArray();
+	json.endObject();
+	json.endLine();
+}
+
 bool
 Streamdeck::sendSources(
 	const rpc::event event,
@@ -517,31 +776,11 @@ Streamdeck::sendSources(
 	const Sources& sources,
 	bool event_mode
 ) {
-	QJsonObject response = buildJsonResponse(event, QString::fromStdString(resource), event_mode);
-	QString collection_id = "";
-	if(sources.collection != nullptr)
-		collection_id = QString("%1").arg(sources.collection->id());
-	addToJsonObject(response, "collection", collection_id);
-
-	QJsonArray result;
-	for(auto iter_src = sources.sources.begin(); iter_src < sources.sources.end(); iter_src++) {
-		Source* source_ptr = (*iter_src);
-		QJsonObject source;
-		uint64_t source_id = source_ptr->id();
-		if(sources.collection != nullptr)
-			source_id += (sources.collection->id() << 18) + ((source_ptr->registrable() ? 1 : 2) << 16);
-		addToJsonObject(source, "id", QString("%1").arg(source_id));
-		addToJsonObject(source, "name", QString::fromStdString(source_ptr->name()));
-		addToJsonObject(source, "type", source_ptr->type());
-		addToJsonObject(source, "muted", source_ptr->muted());
-		addToJsonObject(source, "audio", source_ptr->audio());
-		addToJsonArray(result, source);
-	}
-	addToJsonObject(response, "result", result);
+	renderSources(outputBuffer(), event, resource, sources, event_mode);
 
 	log_custom(LOG_STREAMDECK) << QString("Send sources.").toStdString() << log_end;
 
-	send(event, QJsonDocument(response));
+	send(event, m_output);
 	return true;
 }
 
@@ -553,16 +792,34 @@ Streamdeck::sendSources(
 
 void
 StreamdeckClient::read() {
-	while(m_internalSocket != nullptr && m_internalSocket->canReadLine()) {
+	while(m_internalSocket != nullptr && m_internalSocket->bytesAvailable() > 0) {
 		try {
-			log_custom(LOG_STREAMDECK_CLIENT) << "[Streamdeck Client] Read message..." << log_end;
-			QByteArray data = m_internalSocket->readLine();
-			QJsonDocument json_quest = QJsonDocument::fromJson(data);
-			if(_is_verbose) {
-				std::string log = json_quest.toJson(QJsonDocument::JsonFormat::Indented).toStdString();
-				log_custom(LOG_STREAMDECK_CLIENT) << log << log_end;
+			// Socket data lands directly in the ring, frames are parsed in place
+			size_t length = 0;
+			char* tail = m_inbound.reserve(length);
+			qint64 received = m_internalSocket->read(tail, (qint64)length);
+			if(received <= 0)
+				break;
+			m_inbound.commit((size_t)received);
+
+			const char* frame = nullptr;
+			size_t frame_length = 0;
+			while(m_inbound.next(frame, frame_length)) {
+				log_custom(LOG_STREAMDECK_CLIENT) << "[Streamdeck Client] Read message..." << log_end;
+				if(_is_verbose) {
+					std::string log(frame, frame_length);
+					log_custom(LOG_STREAMDECK_CLIENT) << log << log_end;
+				}
+				rpc::message message;
+				rpc::parser::parse(frame, frame_length, message);
+				emit read(message);
+			}
+
+			if(m_inbound.size() > RPC_MAX_FRAME_SIZE) {
+				log_warn << "[Streamdeck Client] Incoming message is too large." << log_end;
+				m_internalSocket->abort();
+				return;
 			}
-			emit read(json_quest);
 		}
 		catch(...) {
 			m_internalSocket->abort();
@@ -571,37 +828,95 @@ StreamdeckClient::read() {
 }
 
 void
-StreamdeckClient::write(QJsonDocument document) {
-	log_custom(LOG_STREAMDECK_CLIENT) << QString("[Streamdeck Client] Write message...").toStdString()
-		<< log_end;
+StreamdeckClient::write(rpc::batch batch) {
+	log_custom(LOG_STREAMDECK_CLIENT) << QString("[Streamdeck Client] Write %1 message(s)...")
+		.arg(batch.size()).toStdString() << log_end;
+
+	for(auto iter = batch.begin(); iter != batch.end(); iter++) {
+		if(_is_verbose) {
+			std::string log = iter->data.toStdString();
+			log_custom(LOG_STREAMDECK_CLIENT) << log << log_end;
+		}
+
+		// A pending state of the same event and scope is outdated by this one, it is dropped
+		if(iter->mergeable) {
+			for(auto pending = m_outbound.begin(); pending != m_outbound.end();) {
+				if(pending->mergeable && pending->event == iter->event && pending->scope == iter->scope) {
+					m_outboundBytes -= pending->data.size();
+					pending = m_outbound.erase(pending);
+				}
+				else {
+					pending++;
+				}
+			}
+		}
 
-	if(_is_verbose) {
-		std::string log = document.toJson(QJsonDocument::JsonFormat::Indented).toStdString();
-		log_custom(LOG_STREAMDECK_CLIENT) << log << log_end;
+		m_outboundBytes += iter->data.size();
+		m_outbound.enqueue(*iter);
 	}
 
-	QByteArray data = document.toJson(QJsonDocument::JsonFormat::Compact).append("\n");
-	bool result = false;
-	if(m_internalSocket != nullptr && m_internalSocket->isValid()) {
-		result = m_internalSocket->write(data) == data.length();
+	flush();
+}
+
+void
+StreamdeckClient::flush() {
+	if(m_internalSocket == nullptr || !m_internalSocket->isValid()) {
+		m_outbound.clear();
+		m_outboundBytes = 0;
+		m_queueDepth = 0;
+		m_bytesPending = 0;
+		return;
 	}
 
-	if(!result)
-		m_internalSocket->close();
+	// Everything that fits under the high watermark is gathered in a single write
+	qint64 buffered = m_internalSocket->bytesToWrite();
+	if(!m_outbound.isEmpty() && buffered < _high_watermark) {
+		QByteArray gathered = m_outbound.dequeue().data;
+		while(!m_outbound.isEmpty() &&
+			buffered + gathered.size() + m_outbound.head().data.size() <= _high_watermark) {
+			gathered.append(m_outbound.dequeue().data);
+		}
+		m_outboundBytes -= gathered.size();
+
+		if(m_internalSocket->write(gathered) < 0) {
+			log_warn << "[Streamdeck Client] Socket write failed." << log_end;
+			close();
+			return;
+		}
+		buffered = m_internalSocket->bytesToWrite();
+	}
+
+	m_queueDepth = m_outbound.size();
+	m_bytesPending = m_outboundBytes + buffered;
+
+	if(m_bytesPending > _max_pending) {
+		log_warn << "[Streamdeck Client] Client does not read its messages anymore." << log_end;
+		m_internalSocket->abort();
+	}
 }
 
 void
-Streamdeck::read(QJsonDocument json_quest) {
-	if(!m_internalClient.isRunning())
+StreamdeckClient::written(qint64 bytes) {
+	Q_UNUSED(bytes);
+
+	// Remaining messages wait for the socket buffer to drain under the low watermark
+	if(m_internalSocket != nullptr && m_internalSocket->bytesToWrite() > _low_watermark) {
+		m_bytesPending = m_outboundBytes + m_internalSocket->bytesToWrite();
 		return;
+	}
 
-	log_custom(LOG_STREAMDECK) << "[Streamdeck] Internal client notified a new message." << log_end;
+	flush();
+}
+
+void
+Streamdeck::read(rpc::message message) {
+	if(!m_internalClient.isConnected())
+		return;
 
-	rpc::event event;
-	QString service, method;
-	QVector<QVariant> args;
+	log_custom(LOG_STREAMDECK) << "[Streamdeck] Internal client notified a new message." << log_end;
 
-	this->parse(json_quest, event, service, method, args);
+	rpc::event event = message.event;
+	logEvent(event, message.frame);
 
 	// This event is read-blocked, we skip the event
 	if(checkEventAuthorizations(event, EVENT_READ) == false)
@@ -610,71 +925,68 @@ Streamdeck::read(QJsonDocument json_quest) {
 	lockEventAuthorizations(event);
 
 	bool error = true;
-	emit received(this, event, service, method, args, error);
+	emit received(this, event, message.service, message.method, message.args, error);
 	if(error)
 		close();
 }
 
 void
-Streamdeck::parse(
-	const QJsonDocument& json_quest,
-	rpc::event& event,
-	QString& service, 
-	QString& method,
-	QVector<QVariant>& args
-) {
-	log_info << "[Streamdeck]Parsing message..." << log_end;
-
-	event = (rpc::event)(json_quest["id"].isUndefined() ? rpc::event::ERROR :
-		json_quest["id"].toInt() >= (int)rpc::event::COUNT ? rpc::event::ERROR :
-		rpc::event(json_quest["id"].toInt()));
+Streamdeck::send(const rpc::event event, const QJsonDocument& json_quest) {
+	send(event, json_quest.toJson(QJsonDocument::JsonFormat::Compact).append('\n'));
+}
 
-	method = json_quest["method"].toString();
+void
+Streamdeck::send(const rpc::event event, const QByteArray& data, bool mergeable, uint64_t scope) {
 
-	QJsonObject params = json_quest["params"].toObject();
-	service = params["resource"].toString();
+	// This event is read only - skip the message
+	if(checkEventAuthorizations(event, EVENT_WRITE) == false)
+		return;
 
-	if(params.find("args") != params.end() && params["args"].isArray()) {
-		QJsonArray json_args = params["args"].toArray();
-		args = QVector<QVariant>::fromList(json_args.toVariantList());
-	}
+	unlockEventAuthorizations(event);
 
-	// Because Elgato guys don't know how to make a clear protocol
-	if(params.find("sceneId") != params.end()) {
-		uint64_t scene_id = params["sceneId"].toString().toULongLong();
-		uint16_t collection_id = scene_id >> 18;
-		scene_id = (scene_id) & 0x0FFFF;
+	// Messages produced during this event loop iteration are handed to the client at once
+	if(m_pending.isEmpty())
+		QMetaObject::invokeMethod(this, "flush", Qt::QueuedConnection);
 
-		args.append(QList<QVariant>({ collection_id, (uint16_t)scene_id }));
-	}
+	m_pending.append(rpc::outbound { event, mergeable, scope, data });
+}
 
-	if(params.find("sceneItemId") != params.end()) {
-		uint16_t item_id = params["sceneItemId"].toString().toUInt();
-		args.append(item_id);
-	}
+void
+Streamdeck::flush() {
+	if(m_pending.isEmpty())
+		return;
 
-	if(params.find("sourceId") != params.end()) {
-		uint64_t source_id = params["sourceId"].toString().toULongLong();
-		uint16_t collection_id = source_id >> 18;
-		uint16_t type = (source_id >> 16) & 0x03;
-		source_id = (source_id) & 0x0FFFF;
+	rpc::batch batch;
+	batch.swap(m_pending);
+	emit write(batch);
+}
 
-		args.append(QList<QVariant>({ collection_id, (uint16_t)type, (uint16_t)source_id }));
-	}
+bool
+Streamdeck::sendFrame(const rpc::event event, const rpc::frame& frame) {
+	if(frame.empty())
+		return false;
 
-	logEvent(event, json_quest);
-}
+	// In the case of FETCH, Streamdeck doesn't respect its own protocol
+	rpc::event sent = event;
+	if(event == rpc::event::FETCH_COLLECTIONS_SCHEMA)
+		sent = rpc::event::GET_COLLECTIONS;
 
-void
-Streamdeck::send(const rpc::event event, const QJsonDocument& json_quest) {
+	if(!frame.spliced()) {
+		send(sent, frame.data(), frame.superseding(), frame.scope());
+		return true;
+	}
 
-	// This event is read only - skip the message
-	if(checkEventAuthorizations(event, EVENT_WRITE) == false)
-		return;
+	// Event frames are completed with the resource this client subscribed with
+	auto iter = m_subscribedResources.find(event);
+	if(iter == m_subscribedResources.end())
+		return false;
 
-	unlockEventAuthorizations(event);
+	log_custom(LOG_STREAMDECK) << QString("Send Event Message to %1.")
+		.arg(iter->second.c_str())
+		.toStdString() << log_end;
 
-	emit write(json_quest);
+	send(sent, frame.render(iter->second), frame.superseding(), frame.scope());
+	return true;
 }
 
 /*
@@ -897,11 +1209,33 @@ StreamdeckClient::socket() const {
 	return m_internalSocket;
 }
 
+bool
+StreamdeckClient::isConnected() const {
+	return m_connected;
+}
+
+int
+StreamdeckClient::queueDepth() const {
+	return m_queueDepth;
+}
+
+qint64
+StreamdeckClient::bytesPending() const {
+	return m_bytesPending;
+}
+
+void
+StreamdeckClient::setWatermarks(qint64 high, qint64 low, qint64 max_pending) {
+	_high_watermark = high;
+	_low_watermark = std::min(low, high);
+	_max_pending = std::max(max_pending, high);
+}
+
 void
 StreamdeckClient::close() {
 	log_custom(LOG_STREAMDECK_CLIENT) << "[Streamdeck Client] Connection was lost with a client."
 		<< log_end;
-	exit(0);
+	m_connected = false;
 	if(m_internalSocket != nullptr && m_internalSocket->isOpen()) {
 		m_internalSocket->close();
 		disconnect(m_internalSocket, SIGNAL(disconnected(void)), this, SLOT(disconnected(void)));
@@ -913,6 +1247,7 @@ StreamdeckClient::close() {
 
 void
 StreamdeckClient::disconnected() {
+	m_connected = false;
 	emit disconnected(0);
 }
 
@@ -923,36 +1258,30 @@ StreamdeckClient::disconnected() {
 */
 
 StreamdeckClient*
-Streamdeck::createClient(qintptr socket_descriptor) {
-
-	bool_s ready = shared_variable<bool>("ready", false);
-	bool_s socket_created = shared_variable<bool>("socket_created", false);
-
-	StreamdeckClient* client = new StreamdeckClient(socket_descriptor);
-	client->start();
-
-	ready = true;
-	socket_created.wait([](const bool& value) {return value == true; });
-
-	if(client->m_internalSocket == nullptr) {
-		delete client;
-		client = nullptr;
-	}
-
-	// While the thread was created in the main thread, it belonged to its.
-	client->moveToThread(client);
+Streamdeck::createClient(qintptr socket_descriptor, StreamdeckReactor* reactor) {
 
+	// The client is handled by the reactor event loop, the socket must be created there.
+	StreamdeckClient* client = new StreamdeckClient(socket_descriptor, reactor);
+	client->moveToThread(reactor);
 	return client;
 }
 
+void
+StreamdeckClient::accept() {
+	m_acceptTimer.start();
+	QMetaObject::invokeMethod(this, "open", Qt::QueuedConnection);
+}
+
 void
 StreamdeckClient::ready() {
-	m_startExecution = true;
+	QMetaObject::invokeMethod(this, "start", Qt::QueuedConnection);
 }
 
 void
 Streamdeck::close() {
 	log_custom(LOG_STREAMDECK) << "[Streamdeck] Closing..." << log_end;
+	// Messages of this iteration must reach the client before it closes
+	flush();
 	emit close_client();
 }
 
@@ -962,6 +1291,56 @@ Streamdeck::disconnected(int code) {
 	emit clientDisconnected(this, code);
 }
 
+/*
+========================================================================================================
+	Deltas Handling
+========================================================================================================
+*/
+
+void
+Streamdeck::enableDeltas(uint16_t collection) {
+	m_deltaMode = true;
+	m_deltaCollection = collection;
+
+	// Nothing acknowledged yet, the first delta is a snapshot
+	m_acknowledgedRevision = Revision{ 0, 0 };
+}
+
+bool
+Streamdeck::followsDeltas(const Collection* collection) const {
+	if(!m_deltaMode || collection == nullptr)
+		return false;
+
+	// Collection 0 follows the active collection
+	if(m_deltaCollection == 0)
+		return collection->active;
+
+	return m_deltaCollection == collection->id();
+}
+
+bool
+Streamdeck::subscribed(const rpc::event event) const {
+	return m_subscribedResources.find(event) != m_subscribedResources.end();
+}
+
+bool
+Streamdeck::supersededByDeltas(const rpc::event event) const {
+	return m_deltaMode && (event == rpc::event::GET_SCENES || event == rpc::event::GET_SOURCES);
+}
+
+uint64_t
+Streamdeck::acknowledgedRevision(const Collection* collection) const {
+	if(collection == nullptr || m_acknowledgedRevision.collection != collection->id())
+		return 0;
+
+	return m_acknowledgedRevision.revision;
+}
+
+void
+Streamdeck::acknowledgeRevision(const Revision& revision) {
+	m_acknowledgedRevision = revision;
+}
+
 /*
 ========================================================================================================
 	Logging
@@ -969,7 +1348,7 @@ Streamdeck::disconnected(int code) {
 */
 
 void
-Streamdeck::logEvent(const rpc::event event, const QJsonDocument& json_quest) {
+Streamdeck::logEvent(const rpc::event event, const QByteArray& frame) {
 	switch(event) {
 		case rpc::event::START_RECORDING:
 			log_custom(0x33ff02) << QString("Action START_RECORD (%1)").arg((int)event).toStdString()
@@ -1003,6 +1382,7 @@ Streamdeck::logEvent(const rpc::event event, const QJsonDocument& json_quest) {
 		case rpc::event::SOURCE_ADDED_SUBSCRIBE:
 		case rpc::event::SOURCE_REMOVED_SUBSCRIBE:
 		case rpc::event::SOURCE_UPDATED_SUBSCRIBE:
+		case rpc::event::DELTAS_SUBSCRIBE:
 			log_custom(0xffb520) << QString("Subscribe Event (%1)").arg((int)event).toStdString()
 				<< log_end;
 			break;
@@ -1053,10 +1433,14 @@ Streamdeck::logEvent(const rpc::event event, const QJsonDocument& json_quest) {
 			log_custom(0x13abb0) << "Make scene active" << log_end;
 			break;
 
+		case rpc::event::ACKNOWLEDGE_REVISION:
+			log_custom(0xc0c0c0) << "Acknowledge revision" << log_end;
+			break;
+
 		case rpc::event::ERROR:
 		default:
 			log_warn << "Unknown event: " << log_end;
-			std::string log = json_quest.toJson(QJsonDocument::JsonFormat::Indented).toStdString();
+			std::string log = frame.toStdString();
 			log_warn << log << log_end;
 			break;
 	}
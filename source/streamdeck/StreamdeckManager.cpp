@@ -1,7 +1,6 @@
 /*
  * Plugin Includes
  */
-#include "include/common/SharedVariables.hpp"
 #include "include/streamdeck/StreamdeckManager.hpp"
 #include "include/common/Logger.hpp"
 
@@ -13,38 +12,71 @@
 
 StreamdeckServer::StreamdeckServer(QObject* parent) :
 	QTcpServer(parent) {
-	log_info << "[Streamdeck Server] Ready." << log_end;
+	// Inbound messages are parsed on the reactors and queued to the main thread
+	qRegisterMetaType<rpc::message>("rpc::message");
+	qRegisterMetaType<rpc::batch>("rpc::batch");
+
+	// Clients are spread over a small fixed pool of event loops instead of one thread each.
+	int nb_reactors = std::min(std::max(QThread::idealThreadCount() / 2, 1), MAX_REACTORS);
+	for(int i = 0; i < nb_reactors; i++) {
+		StreamdeckReactor* reactor = new StreamdeckReactor();
+		reactor->start();
+		m_reactors.push_back(reactor);
+	}
+	log_info << QString("[Streamdeck Server] Ready with %1 reactor(s).").arg(nb_reactors)
+		.toStdString() << log_end;
 }
 
 StreamdeckServer::~StreamdeckServer() {
 	close();
+	// Clients not handed to the manager yet are destroyed with the others by their reactor
+	m_pendingClients.clear();
+	for(StreamdeckReactor* reactor : m_reactors)
+		delete reactor;
+	m_reactors.clear();
 	log_info << "[Streamdeck Server] Close." << log_end;
 }
 
 StreamdeckManager::StreamdeckManager() : 
-	m_internalServer(this) {
+	m_internalServer(this),
+	m_coalescingWindow(COALESCING_WINDOW),
+	m_eventsIn(0),
+	m_eventsOut(0),
+	m_cacheHits(0),
+	m_cacheMisses(0) {
 	for(int i = 1; i < (int)rpc::event::COUNT; i++)
 		this->addEvent((rpc::event)i);
 	
-	m_internalServer.connect(&m_internalServer, &StreamdeckServer::newConnection, this, 
+	// QTcpServer::newConnection fires before the client socket is opened on its reactor
+	m_internalServer.connect(&m_internalServer, &StreamdeckServer::clientReady, this,
 		&StreamdeckManager::onClientConnected);
+
+	m_coalescingTimer.setSingleShot(true);
+	connect(&m_coalescingTimer, &QTimer::timeout, this, &StreamdeckManager::onCoalescingTimeout);
 }
 
 StreamdeckManager::~StreamdeckManager() {
 	for(int i = 1; i < (int)rpc::event::COUNT; i++)
 		this->removeEvent((rpc::event)i);
 
+	// Streamdecks release their client to its reactor, which destroys it before stopping
 	for(auto i = m_streamdecks.begin(); i != m_streamdecks.end();) {
 		Streamdeck* cl = *i;
 		i++;
 		close(cl);
+		disconnect(cl, &Streamdeck::clientDisconnected, this, &StreamdeckManager::onClientDisconnected);
+		disconnect(cl, &Streamdeck::received, this, &StreamdeckManager::receiveMessage);
+		delete cl;
 	}
 
 	m_streamdecks.clear();
 
-	m_internalServer.disconnect(&m_internalServer, &StreamdeckServer::newConnection, this,
+	m_internalServer.disconnect(&m_internalServer, &StreamdeckServer::clientReady, this,
 		&StreamdeckManager::onClientConnected);
 
+	m_coalescingTimer.stop();
+	disconnect(&m_coalescingTimer, &QTimer::timeout, this, &StreamdeckManager::onCoalescingTimeout);
+
 	m_internalServer.close();
 }
 
@@ -63,13 +95,37 @@ StreamdeckManager::listen(short listen_port) {
 void
 StreamdeckServer::incomingConnection(qintptr socketDescriptor) {
 	log_info << "[Streamdeck Server] New incoming connection." << log_end;
-	StreamdeckClient* client = Streamdeck::createClient(socketDescriptor);
-	if(client != nullptr) {
-		log_info << "[Streamdeck Server] Client created, add to pending list." << log_end;
-		QTcpSocket* socket = client->socket();
-		m_pendingClients[socket] = client;
-		addPendingConnection(socket);
+	StreamdeckClient* client = Streamdeck::createClient(socketDescriptor, nextReactor());
+	connect(client, &StreamdeckClient::opened, this, &StreamdeckServer::onClientOpened);
+	client->accept();
+}
+
+void
+StreamdeckServer::onClientOpened(StreamdeckClient* client, bool success) {
+	disconnect(client, &StreamdeckClient::opened, this, &StreamdeckServer::onClientOpened);
+
+	if(!success) {
+		log_error << "[Streamdeck Server] Client socket could not be opened, connection dropped."
+			<< log_end;
+		client->deleteLater();
+		return;
 	}
+
+	log_info << "[Streamdeck Server] Client created, add to pending list." << log_end;
+	QTcpSocket* socket = client->socket();
+	m_pendingClients[socket] = client;
+	addPendingConnection(socket);
+	emit clientReady();
+}
+
+StreamdeckReactor*
+StreamdeckServer::nextReactor() const {
+	StreamdeckReactor* reactor = m_reactors.front();
+	for(StreamdeckReactor* candidate : m_reactors) {
+		if(candidate->load() < reactor->load())
+			reactor = candidate;
+	}
+	return reactor;
 }
 
 StreamdeckClient*
@@ -78,8 +134,7 @@ StreamdeckServer::nextPendingClient() {
 		return nullptr;
 
 	QTcpSocket* socket = this->nextPendingConnection();
-	auto client_info = m_pendingClients.find(socket);
-	return client_info != m_pendingClients.end() ? client_info.value() : nullptr;
+	return m_pendingClients.take(socket);
 }
 
 void
@@ -123,6 +178,17 @@ StreamdeckManager::close(Streamdeck* streamdeck) {
 	streamdeck->close();
 }
 
+bool
+StreamdeckManager::subscribed(std::initializer_list<rpc::event> events) const {
+	for(auto iter = m_streamdecks.begin(); iter != m_streamdecks.end(); iter++) {
+		for(auto event = events.begin(); event != events.end(); event++) {
+			if((*iter)->subscribed(*event))
+				return true;
+		}
+	}
+	return false;
+}
+
 QString
 StreamdeckManager::formatResource(const rpc::response_base& response) {
 	if(response.request == nullptr) {
@@ -207,6 +273,183 @@ StreamdeckManager::setSources(Streamdeck* client, const rpc::response<Sources>&
 	return client->sendSources(response.event, resource.toStdString(), response.data);
 }
 
+bool
+StreamdeckManager::setDeltaSubscription(
+	Streamdeck* client,
+	const rpc::response<CollectionPtr>& response
+) {
+	QString resource = formatResource(response);
+	if(!client->sendSubscription(response.event, resource.toStdString()))
+		return false;
+
+	client->enableDeltas(response.data != nullptr ? response.data->id() : 0);
+	return true;
+}
+
+bool
+StreamdeckManager::setRevision(Streamdeck* client, const rpc::response<Revision>& response) {
+	client->acknowledgeRevision(response.data);
+
+	rpc::response<void> acknowledge{
+		{response.request, response.event, response.serviceName, response.method}
+	};
+	return setAcknowledge(client, acknowledge);
+}
+
+bool
+StreamdeckManager::renderCollections(const rpc::response<Collections>& response, rpc::frame& frame) {
+	QByteArray output;
+	Streamdeck::renderCollections(output, response.event, formatResource(response).toStdString(),
+		response.data);
+	frame = rpc::frame(output, -1, true);
+	return true;
+}
+
+bool
+StreamdeckManager::renderScenes(const rpc::response<Scenes>& response, rpc::frame& frame) {
+	QByteArray output;
+	Streamdeck::renderScenes(output, response.event, formatResource(response).toStdString(),
+		response.data);
+	// Scenes of another collection don't supersede these ones
+	uint64_t scope = response.data.collection != nullptr ? response.data.collection->id() : 0;
+	frame = rpc::frame(output, -1, true, scope);
+	return true;
+}
+
+bool
+StreamdeckManager::renderSources(const rpc::response<Sources>& response, rpc::frame& frame) {
+	QByteArray output;
+	Streamdeck::renderSources(output, response.event, formatResource(response).toStdString(),
+		response.data);
+	// Sources of another collection don't supersede these ones
+	uint64_t scope = response.data.collection != nullptr ? response.data.collection->id() : 0;
+	frame = rpc::frame(output, -1, true, scope);
+	return true;
+}
+
+bool
+StreamdeckManager::renderSchema(const rpc::response<Collections>& response, rpc::frame& frame) {
+	// Streamdeck expects the schema as a GET_COLLECTIONS event, answered on the resource it
+	// subscribed with : resourceId is the last key of the last object, spliced before the final "}}
+	QByteArray output;
+	Streamdeck::renderCollections(output, rpc::event::GET_COLLECTIONS, "", response.data, true);
+	frame = rpc::frame(output, output.size() - 4, true);
+	return true;
+}
+
+/*
+========================================================================================================
+	Responses Cache
+========================================================================================================
+*/
+
+uint64_t
+StreamdeckManager::cacheHits() const {
+	return m_cacheHits;
+}
+
+uint64_t
+StreamdeckManager::cacheMisses() const {
+	return m_cacheMisses;
+}
+
+/*
+========================================================================================================
+	Deltas
+========================================================================================================
+*/
+
+bool
+StreamdeckManager::commit_deltas(const Collection* collection, Streamdeck* streamdeck) {
+	if(collection == nullptr)
+		return false;
+
+	bool result = true;
+
+	// Clients which acknowledged the same revision share the same frame
+	std::map<uint64_t, rpc::frame> frames;
+	SnapshotPtr snapshot = collection->snapshot();
+
+	for(auto i = m_streamdecks.begin(); i != m_streamdecks.end();) {
+		Streamdeck* client = *i;
+		++i;
+
+		if((streamdeck != nullptr && client != streamdeck) || !client->followsDeltas(collection))
+			continue;
+
+		uint64_t revision = client->acknowledgedRevision(collection);
+		auto frame = frames.find(revision);
+		if(frame == frames.end())
+			frame = frames.emplace(revision, Streamdeck::renderDelta(collection->delta(revision), *snapshot)).first;
+
+		if(frame->second.empty())
+			continue;
+
+		if(!client->sendFrame(rpc::event::DELTAS_SUBSCRIBE, frame->second)) {
+			this->close(client);
+			result = false;
+		}
+	}
+
+	return result;
+}
+
+/*
+========================================================================================================
+	Events Coalescing
+========================================================================================================
+*/
+
+void
+StreamdeckManager::setCoalescingWindow(int window_ms) {
+	m_coalescingWindow = std::max(window_ms, 0);
+}
+
+uint64_t
+StreamdeckManager::eventsIn() const {
+	return m_eventsIn;
+}
+
+uint64_t
+StreamdeckManager::eventsOut() const {
+	return m_eventsOut;
+}
+
+bool
+StreamdeckManager::commit_coalesced(rpc::response<void>& response) {
+	if(!this->validate(response))
+		return false;
+
+	// Notifications carry no payload, all the ones of a window are the same for the clients
+	m_eventsIn++;
+	m_coalescedEvents.set((size_t)response.event);
+
+	if(!m_coalescingTimer.isActive())
+		m_coalescingTimer.start(m_coalescingWindow);
+
+	return true;
+}
+
+void
+StreamdeckManager::onCoalescingTimeout() {
+	std::bitset<(size_t)rpc::event::COUNT> events;
+	std::swap(events, m_coalescedEvents);
+
+	for(size_t i = 1; i < events.size(); i++) {
+		if(!events.test(i))
+			continue;
+
+		rpc::response<void> response{
+			{nullptr, (rpc::event)i, "StreamdeckManager", "onCoalescingTimeout"}
+		};
+		m_eventsOut++;
+		commit_all(response, &StreamdeckManager::renderEvent);
+	}
+
+	log_custom(LOG_STREAMDECK_MANAGER) << QString("[Streamdeck Manager] Notifications : "
+		"%1 received, %2 sent.").arg(m_eventsIn).arg(m_eventsOut).toStdString() << log_end;
+}
+
 /*
 ========================================================================================================
 	Messages Handling
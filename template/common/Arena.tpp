@@ -0,0 +1,60 @@
+/*
+ * Plugin Includes
+ */
+#include "include/common/Arena.hpp"
+
+/*
+========================================================================================================
+	Constructors / Destructor
+========================================================================================================
+*/
+
+template<typename T>
+ArenaAllocator<T>::ArenaAllocator(const std::shared_ptr<Arena>& arena) :
+	m_arena(arena) {
+}
+
+template<typename T>
+template<typename U>
+ArenaAllocator<T>::ArenaAllocator(const ArenaAllocator<U>& allocator) :
+	m_arena(allocator.m_arena) {
+}
+
+/*
+========================================================================================================
+	Allocation
+========================================================================================================
+*/
+
+template<typename T>
+T*
+ArenaAllocator<T>::allocate(size_t count) {
+	static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned types aren't supported");
+	return static_cast<T*>(m_arena->allocate(count * sizeof(T)));
+}
+
+template<typename T>
+void
+ArenaAllocator<T>::deallocate(T* pointer, size_t count) {
+	m_arena->deallocate(pointer, count * sizeof(T));
+}
+
+/*
+========================================================================================================
+	Operators
+========================================================================================================
+*/
+
+template<typename T>
+template<typename U>
+bool
+ArenaAllocator<T>::operator==(const ArenaAllocator<U>& allocator) const {
+	return m_arena == allocator.m_arena;
+}
+
+template<typename T>
+template<typename U>
+bool
+ArenaAllocator<T>::operator!=(const ArenaAllocator<U>& allocator) const {
+	return m_arena != allocator.m_arena;
+}
\ No newline at end of file
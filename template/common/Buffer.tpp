@@ -0,0 +1,65 @@
+/*
+ * Plugin Includes
+ */
+#include "include/common/Buffer.hpp"
+
+/*
+========================================================================================================
+	Writing
+========================================================================================================
+*/
+
+template<typename T>
+BufferWriter&
+BufferWriter::write(T value) {
+	static_assert(std::is_integral<T>::value, "Only integral values are serialized");
+	typedef typename std::make_unsigned<T>::type U;
+
+	byte* bytes = grow(sizeof(T));
+	for(size_t i = 0; i < sizeof(T); i++)
+		bytes[i] = static_cast<byte>((static_cast<U>(value) >> (8 * i)) & 0xFF);
+	return *this;
+}
+
+template<typename T>
+size_t
+BufferWriter::reserve() {
+	size_t offset = m_buffer.size();
+	grow(sizeof(T));
+	return offset;
+}
+
+template<typename T>
+void
+BufferWriter::patch(size_t offset, T value) {
+	static_assert(std::is_integral<T>::value, "Only integral values are serialized");
+	typedef typename std::make_unsigned<T>::type U;
+
+	// Only reserved places are patched, they always lie within the written bytes
+	byte* bytes = m_buffer.data() + offset;
+	for(size_t i = 0; i < sizeof(T); i++)
+		bytes[i] = static_cast<byte>((static_cast<U>(value) >> (8 * i)) & 0xFF);
+}
+
+/*
+========================================================================================================
+	Reading
+========================================================================================================
+*/
+
+template<typename T>
+bool
+BufferReader::read(T& value) {
+	static_assert(std::is_integral<T>::value, "Only integral values are serialized");
+	typedef typename std::make_unsigned<T>::type U;
+
+	const byte* bytes = take(sizeof(T));
+	if(bytes == nullptr)
+		return false;
+
+	U result = 0;
+	for(size_t i = 0; i < sizeof(T); i++)
+		result |= static_cast<U>(static_cast<uint8_t>(bytes[i])) << (8 * i);
+	value = static_cast<T>(result);
+	return true;
+}
\ No newline at end of file
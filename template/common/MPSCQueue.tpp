@@ -0,0 +1,134 @@
+/*
+ * Std Includes
+ */
+#include <algorithm>
+#include <utility>
+
+/*
+ * Plugin Includes
+ */
+#include "include/common/MPSCQueue.hpp"
+
+/*
+========================================================================================================
+	Constructors / Destructor
+========================================================================================================
+*/
+
+template<typename T>
+MPSCQueue<T>::MPSCQueue(size_t capacity) :
+	m_slots(new T[std::max<size_t>(capacity, 1)]),
+	m_capacity(std::max<size_t>(capacity, 1)),
+	m_head(0),
+	m_size(0),
+	m_spilled(0),
+	m_waiting(0) {
+}
+
+template<typename T>
+MPSCQueue<T>::~MPSCQueue() {
+}
+
+/*
+========================================================================================================
+	Producers
+========================================================================================================
+*/
+
+template<typename T>
+bool
+MPSCQueue<T>::tryPush(T& value) {
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	// Values already spilled go first, the ring only takes new ones once the overflow is empty
+	if(m_size == m_capacity || !m_overflow.empty())
+		return false;
+
+	store(value);
+	return true;
+}
+
+template<typename T>
+void
+MPSCQueue<T>::push(T&& value, std::chrono::milliseconds timeout) {
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	if(m_overflow.empty() && m_size == m_capacity) {
+		m_waiting++;
+		m_space.wait_for(lock, timeout, [this]() { return m_size < m_capacity; });
+		m_waiting--;
+	}
+
+	if(m_overflow.empty() && m_size < m_capacity) {
+		store(value);
+		return;
+	}
+
+	m_overflow.push_back(std::move(value));
+	m_spilled++;
+}
+
+template<typename T>
+void
+MPSCQueue<T>::store(T& value) {
+	m_slots[(m_head + m_size) % m_capacity] = std::move(value);
+	m_size++;
+}
+
+/*
+========================================================================================================
+	Consumer
+========================================================================================================
+*/
+
+template<typename T>
+bool
+MPSCQueue<T>::pop(T& value) {
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	if(m_size > 0) {
+		value = std::move(m_slots[m_head]);
+		m_head = (m_head + 1) % m_capacity;
+		m_size--;
+
+		bool waiting = m_waiting > 0;
+		lock.unlock();
+		if(waiting)
+			m_space.notify_one();
+		return true;
+	}
+
+	if(m_overflow.empty())
+		return false;
+
+	value = std::move(m_overflow.front());
+	m_overflow.pop_front();
+	return true;
+}
+
+template<typename T>
+bool
+MPSCQueue<T>::empty() const {
+	std::lock_guard<std::mutex> lock(m_lock);
+	return m_size == 0 && m_overflow.empty();
+}
+
+template<typename T>
+size_t
+MPSCQueue<T>::size() const {
+	std::lock_guard<std::mutex> lock(m_lock);
+	return m_size + m_overflow.size();
+}
+
+template<typename T>
+size_t
+MPSCQueue<T>::capacity() const {
+	return m_capacity;
+}
+
+template<typename T>
+size_t
+MPSCQueue<T>::spilled() const {
+	std::lock_guard<std::mutex> lock(m_lock);
+	return m_spilled;
+}
\ No newline at end of file
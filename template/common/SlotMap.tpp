@@ -0,0 +1,93 @@
+/*
+ * Plugin Includes
+ */
+#include "include/common/SlotMap.hpp"
+
+/*
+========================================================================================================
+	Constructors / Destructor
+========================================================================================================
+*/
+
+template<typename T>
+SlotMap<T>::SlotMap() :
+	m_size(0) {
+}
+
+template<typename T>
+SlotMap<T>::~SlotMap() {
+}
+
+/*
+========================================================================================================
+	Slots Handling
+========================================================================================================
+*/
+
+template<typename T>
+Handle<T>
+SlotMap<T>::insert(T* object) {
+	uint16_t index = 0;
+	if(!m_free.empty()) {
+		index = m_free.back();
+		m_free.pop_back();
+	}
+	else if(m_objects.size() < SLOT_MAP_MAX_SIZE) {
+		index = static_cast<uint16_t>(m_objects.size());
+		m_objects.push_back(nullptr);
+		m_generations.push_back(1);
+	}
+	else
+		return Handle<T>();
+
+	m_objects[index] = object;
+	m_size++;
+	return Handle<T>(index, m_generations[index]);
+}
+
+template<typename T>
+bool
+SlotMap<T>::erase(Handle<T> handle) {
+	if(get(handle) == nullptr)
+		return false;
+
+	release(handle.index());
+	m_size--;
+	return true;
+}
+
+template<typename T>
+T*
+SlotMap<T>::get(Handle<T> handle) const {
+	uint16_t index = handle.index();
+	if(handle.empty() || index >= m_objects.size() || m_generations[index] != handle.generation())
+		return nullptr;
+	return m_objects[index];
+}
+
+template<typename T>
+size_t
+SlotMap<T>::size() const {
+	return m_size;
+}
+
+template<typename T>
+void
+SlotMap<T>::clear() {
+	// Every handle given so far goes stale at once, objects don't have to be visited one by one
+	for(size_t i = 0; i < m_objects.size(); i++) {
+		if(m_objects[i] != nullptr)
+			release(static_cast<uint16_t>(i));
+	}
+	m_size = 0;
+}
+
+template<typename T>
+void
+SlotMap<T>::release(uint16_t index) {
+	m_objects[index] = nullptr;
+	m_generations[index]++;
+	if(m_generations[index] == 0)
+		m_generations[index] = 1;
+	m_free.push_back(index);
+}
\ No newline at end of file
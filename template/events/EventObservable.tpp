@@ -11,10 +11,79 @@
 
 template<typename T>
 EventObservable<T>::EventObservable() {
-
 }
 
 template<typename T>
 EventObservable<T>::~EventObservable() {
+	m_eventHandlers.clear();
+}
+
+/*
+========================================================================================================
+	Event Observers Handling
+========================================================================================================
+*/
+
+template<typename T>
+void
+EventObservable<T>::addEventHandler(const T& event, const EventSlot<T>& event_handler) {
+	if(!event_handler.empty())
+		m_eventHandlers.insert(event, event_handler);
+}
+
+template<typename T>
+void
+EventObservable<T>::remEventHandler(const T& event, const EventSlot<T>& event_handler) {
+	m_eventHandlers.erase(event, event_handler);
+}
+
+/*
+========================================================================================================
+	Events Handling
+========================================================================================================
+*/
+
+template<typename T>
+void
+EventObservable<T>::addEvent(const T& event) {
+	m_eventHandlers.add(event);
+}
+
+template<typename T>
+void
+EventObservable<T>::removeEvent(const T& event) {
+	m_eventHandlers.remove(event);
+}
+
+template<typename T>
+bool
+EventObservable<T>::notifyEvent(const T& event) const {
+	const std::vector<EventSlot<T>>* handlers = m_eventHandlers.handlers(event);
+	if(handlers == nullptr)
+		return false;
+
+	// Indexed loop, a handler may register another one while being notified
+	bool result = handlers->empty();
+	for(size_t i = 0; i < handlers->size(); i++)
+		result |= (*handlers)[i]();
+	return result;
+}
+
+template<typename T>
+template<typename B>
+bool
+EventObservable<T>::notifyEvent(const T& event, const B& data) const {
+	static_assert(
+		std::is_same<const B&, typename event_traits<T>::payload>::value,
+		"Payload doesn't match the event handlers"
+	);
+
+	const std::vector<EventSlot<T>>* handlers = m_eventHandlers.handlers(event);
+	if(handlers == nullptr)
+		return false;
 
+	bool result = handlers->empty();
+	for(size_t i = 0; i < handlers->size(); i++)
+		result |= (*handlers)[i](data);
+	return result;
 }
\ No newline at end of file
@@ -0,0 +1,70 @@
+/*
+ * Plugin Includes
+ */
+#include "include/events/EventSlot.hpp"
+
+/*
+========================================================================================================
+	Constructors / Destructor
+========================================================================================================
+*/
+
+template<typename E, typename... A>
+EventSlot<E, bool(A...)>::EventSlot() :
+	m_instance(nullptr),
+	m_thunk(nullptr) {
+	memset(&m_callback, 0, sizeof(m_callback));
+}
+
+template<typename E, typename... A>
+template<typename T>
+EventSlot<E, bool(A...)>::EventSlot(T* instance, bool (T::*callback)(A...)) :
+	m_instance(instance),
+	m_thunk(&invoke<T>) {
+	typedef bool (T::*Callback)(A...);
+	static_assert(sizeof(Callback) <= sizeof(m_callback), "Callback doesn't fit in the slot");
+
+	// Unused bytes are cleared so slots can be compared bytewise
+	memset(&m_callback, 0, sizeof(m_callback));
+	new (&m_callback) Callback(callback);
+}
+
+/*
+========================================================================================================
+	Dispatch
+========================================================================================================
+*/
+
+template<typename E, typename... A>
+template<typename T>
+bool
+EventSlot<E, bool(A...)>::invoke(const EventSlot<E, bool(A...)>& slot, A... args) {
+	typedef bool (T::*Callback)(A...);
+	const Callback& callback = *reinterpret_cast<const Callback*>(&slot.m_callback);
+	return (static_cast<T*>(slot.m_instance)->*callback)(args...);
+}
+
+template<typename E, typename... A>
+bool
+EventSlot<E, bool(A...)>::operator()(A... args) const {
+	return m_thunk != nullptr && m_thunk(*this, args...);
+}
+
+/*
+========================================================================================================
+	Comparison
+========================================================================================================
+*/
+
+template<typename E, typename... A>
+bool
+EventSlot<E, bool(A...)>::operator==(const EventSlot<E, bool(A...)>& slot) const {
+	return m_instance == slot.m_instance && m_thunk == slot.m_thunk &&
+		memcmp(&m_callback, &slot.m_callback, sizeof(m_callback)) == 0;
+}
+
+template<typename E, typename... A>
+bool
+EventSlot<E, bool(A...)>::empty() const {
+	return m_thunk == nullptr;
+}
\ No newline at end of file
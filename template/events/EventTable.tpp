@@ -0,0 +1,154 @@
+/*
+ * STL Includes
+ */
+#include <algorithm>
+
+/*
+ * Plugin Includes
+ */
+#include "include/events/EventTable.hpp"
+
+/*
+========================================================================================================
+	Map Table
+========================================================================================================
+*/
+
+template<typename T, typename H>
+EventTable<T, H, false>::EventTable() {
+}
+
+template<typename T, typename H>
+EventTable<T, H, false>::~EventTable() {
+	m_handlers.clear();
+}
+
+template<typename T, typename H>
+bool
+EventTable<T, H, false>::contains(const T& event) const {
+	return m_handlers.contains(event);
+}
+
+template<typename T, typename H>
+void
+EventTable<T, H, false>::add(const T& event) {
+	if(!m_handlers.contains(event))
+		m_handlers.insert(event, std::vector<H>());
+}
+
+template<typename T, typename H>
+void
+EventTable<T, H, false>::remove(const T& event) {
+	m_handlers.remove(event);
+}
+
+template<typename T, typename H>
+void
+EventTable<T, H, false>::insert(const T& event, const H& handler) {
+	auto iter = m_handlers.find(event);
+	if(iter != m_handlers.end() && std::find(iter->begin(), iter->end(), handler) == iter->end())
+		iter->push_back(handler);
+}
+
+template<typename T, typename H>
+void
+EventTable<T, H, false>::erase(const T& event, const H& handler) {
+	auto iter = m_handlers.find(event);
+	if(iter != m_handlers.end())
+		iter->erase(std::remove(iter->begin(), iter->end(), handler), iter->end());
+}
+
+template<typename T, typename H>
+const std::vector<H>*
+EventTable<T, H, false>::handlers(const T& event) const {
+	auto iter = m_handlers.constFind(event);
+	return iter != m_handlers.constEnd() ? &(*iter) : nullptr;
+}
+
+template<typename T, typename H>
+void
+EventTable<T, H, false>::clear() {
+	m_handlers.clear();
+}
+
+/*
+========================================================================================================
+	Flat Table
+========================================================================================================
+*/
+
+template<typename T, typename H>
+EventTable<T, H, true>::EventTable() {
+}
+
+template<typename T, typename H>
+EventTable<T, H, true>::~EventTable() {
+	clear();
+}
+
+template<typename T, typename H>
+size_t
+EventTable<T, H, true>::index(const T& event) {
+	// Negative values wrap around and end up out of the table
+	return static_cast<size_t>(event);
+}
+
+template<typename T, typename H>
+bool
+EventTable<T, H, true>::contains(const T& event) const {
+	size_t idx = index(event);
+	return idx < event_traits<T>::size && m_registered.test(idx);
+}
+
+template<typename T, typename H>
+void
+EventTable<T, H, true>::add(const T& event) {
+	size_t idx = index(event);
+	if(idx < event_traits<T>::size)
+		m_registered.set(idx);
+}
+
+template<typename T, typename H>
+void
+EventTable<T, H, true>::remove(const T& event) {
+	size_t idx = index(event);
+	if(idx < event_traits<T>::size) {
+		m_registered.reset(idx);
+		m_handlers[idx].clear();
+	}
+}
+
+template<typename T, typename H>
+void
+EventTable<T, H, true>::insert(const T& event, const H& handler) {
+	if(!contains(event))
+		return;
+
+	std::vector<H>& handlers = m_handlers[index(event)];
+	if(std::find(handlers.begin(), handlers.end(), handler) == handlers.end())
+		handlers.push_back(handler);
+}
+
+template<typename T, typename H>
+void
+EventTable<T, H, true>::erase(const T& event, const H& handler) {
+	if(!contains(event))
+		return;
+
+	std::vector<H>& handlers = m_handlers[index(event)];
+	handlers.erase(std::remove(handlers.begin(), handlers.end(), handler), handlers.end());
+}
+
+template<typename T, typename H>
+const std::vector<H>*
+EventTable<T, H, true>::handlers(const T& event) const {
+	return contains(event) ? &m_handlers[index(event)] : nullptr;
+}
+
+template<typename T, typename H>
+void
+EventTable<T, H, true>::clear() {
+	for(auto i = m_handlers.begin(); i != m_handlers.end(); i++)
+		i->clear();
+	m_registered.reset();
+}
\ No newline at end of file
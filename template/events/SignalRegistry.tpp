@@ -0,0 +1,80 @@
+/*
+ * Plugin Includes
+ */
+#include "include/events/SignalRegistry.hpp"
+
+/*
+========================================================================================================
+	Constructors / Destructor
+========================================================================================================
+*/
+
+template<typename T, size_t N>
+SignalRegistry<T, N>::SignalRegistry() :
+	m_size(0) {
+}
+
+template<typename T, size_t N>
+SignalRegistry<T, N>::~SignalRegistry() {
+}
+
+/*
+========================================================================================================
+	Dispatch
+========================================================================================================
+*/
+
+template<typename T, size_t N>
+void
+SignalRegistry<T, N>::Call(void* entry, calldata_t* data) {
+	const Entry* entry_ref = reinterpret_cast<const Entry*>(entry);
+	(entry_ref->owner->*entry_ref->handler)(data);
+}
+
+/*
+========================================================================================================
+	Registration
+========================================================================================================
+*/
+
+template<typename T, size_t N>
+bool
+SignalRegistry<T, N>::add(const char* signal, T* owner, Handler handler) {
+	if(m_size == N)
+		return false;
+
+	m_entries[m_size++] = Entry{ owner, handler, signal };
+	return true;
+}
+
+template<typename T, size_t N>
+void
+SignalRegistry<T, N>::connect(signal_handler_t* signal_handler) {
+	for(size_t i = 0; i < m_size; i++) {
+		signal_handler_connect(
+			signal_handler,
+			m_entries[i].signal,
+			SignalRegistry<T, N>::Call,
+			&m_entries[i]
+		);
+	}
+}
+
+template<typename T, size_t N>
+void
+SignalRegistry<T, N>::disconnect(signal_handler_t* signal_handler) {
+	for(size_t i = 0; i < m_size; i++) {
+		signal_handler_disconnect(
+			signal_handler,
+			m_entries[i].signal,
+			SignalRegistry<T, N>::Call,
+			&m_entries[i]
+		);
+	}
+}
+
+template<typename T, size_t N>
+size_t
+SignalRegistry<T, N>::size() const {
+	return m_size;
+}
\ No newline at end of file
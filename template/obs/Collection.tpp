@@ -0,0 +1,17 @@
+/*
+ * Plugin Includes
+ */
+#include "include/obs/Collection.hpp"
+
+/*
+========================================================================================================
+	Model Objects
+========================================================================================================
+*/
+
+template<typename T, typename... A>
+std::shared_ptr<T>
+Collection::make(A&&... args) {
+	// One arena allocation for the object and its control block
+	return std::allocate_shared<T>(ArenaAllocator<T>(m_arena), std::forward<A>(args)...);
+}
\ No newline at end of file
@@ -0,0 +1,255 @@
+/*
+ * CRT Includes
+ */
+#include <cstring>
+
+/*
+ * Plugin Includes
+ */
+#include "include/rpc/RPCWriter.hpp"
+
+/*
+========================================================================================================
+	Constructors / Destructor
+========================================================================================================
+*/
+
+template<typename Buffer>
+rpc::json_writer<Buffer>::json_writer(Buffer& buffer) :
+	m_buffer(buffer),
+	m_firstElement(1),
+	m_depth(0) {
+}
+
+template<typename Buffer>
+rpc::json_writer<Buffer>::~json_writer() {
+}
+
+/*
+========================================================================================================
+	Structure
+========================================================================================================
+*/
+
+template<typename Buffer>
+rpc::json_writer<Buffer>&
+rpc::json_writer<Buffer>::beginObject() {
+	separator();
+	m_buffer.push_back('{');
+	m_depth++;
+	m_firstElement |= (1ULL << m_depth);
+	return *this;
+}
+
+template<typename Buffer>
+rpc::json_writer<Buffer>&
+rpc::json_writer<Buffer>::endObject() {
+	m_depth--;
+	m_buffer.push_back('}');
+	return *this;
+}
+
+template<typename Buffer>
+rpc::json_writer<Buffer>&
+rpc::json_writer<Buffer>::beginArray() {
+	separator();
+	m_buffer.push_back('[');
+	m_depth++;
+	m_firstElement |= (1ULL << m_depth);
+	return *this;
+}
+
+template<typename Buffer>
+rpc::json_writer<Buffer>&
+rpc::json_writer<Buffer>::endArray() {
+	m_depth--;
+	m_buffer.push_back(']');
+	return *this;
+}
+
+template<typename Buffer>
+rpc::json_writer<Buffer>&
+rpc::json_writer<Buffer>::key(const char* name) {
+	separator();
+	m_buffer.push_back('"');
+	escape(name, strlen(name));
+	m_buffer.append("\":", 2);
+	// The value directly follows its key, no separator
+	m_firstElement |= (1ULL << m_depth);
+	return *this;
+}
+
+template<typename Buffer>
+rpc::json_writer<Buffer>&
+rpc::json_writer<Buffer>::endLine() {
+	m_buffer.push_back('\n');
+	return *this;
+}
+
+/*
+========================================================================================================
+	Values
+========================================================================================================
+*/
+
+template<typename Buffer>
+rpc::json_writer<Buffer>&
+rpc::json_writer<Buffer>::value(const char* string) {
+	separator();
+	m_buffer.push_back('"');
+	if(string != nullptr)
+		escape(string, strlen(string));
+	m_buffer.push_back('"');
+	return *this;
+}
+
+template<typename Buffer>
+rpc::json_writer<Buffer>&
+rpc::json_writer<Buffer>::value(const std::string& string) {
+	separator();
+	m_buffer.push_back('"');
+	escape(string.data(), string.size());
+	m_buffer.push_back('"');
+	return *this;
+}
+
+template<typename Buffer>
+rpc::json_writer<Buffer>&
+rpc::json_writer<Buffer>::value(const QString& string) {
+	QByteArray utf8 = string.toUtf8();
+	separator();
+	m_buffer.push_back('"');
+	escape(utf8.constData(), (size_t)utf8.size());
+	m_buffer.push_back('"');
+	return *this;
+}
+
+template<typename Buffer>
+rpc::json_writer<Buffer>&
+rpc::json_writer<Buffer>::value(const Name& name) {
+	// Interned names carry their escaped form
+	const std::string& escaped = name.escaped();
+	separator();
+	m_buffer.push_back('"');
+	m_buffer.append(escaped.data(), (int)escaped.size());
+	m_buffer.push_back('"');
+	return *this;
+}
+
+template<typename Buffer>
+rpc::json_writer<Buffer>&
+rpc::json_writer<Buffer>::value(bool boolean) {
+	separator();
+	if(boolean)
+		m_buffer.append("true", 4);
+	else
+		m_buffer.append("false", 5);
+	return *this;
+}
+
+template<typename Buffer>
+rpc::json_writer<Buffer>&
+rpc::json_writer<Buffer>::value(int32_t number) {
+	separator();
+	integer(number < 0 ? (uint64_t)(-(int64_t)number) : (uint64_t)number, number < 0);
+	return *this;
+}
+
+template<typename Buffer>
+rpc::json_writer<Buffer>&
+rpc::json_writer<Buffer>::quoted(uint64_t number) {
+	separator();
+	m_buffer.push_back('"');
+	integer(number, false);
+	m_buffer.push_back('"');
+	return *this;
+}
+
+template<typename Buffer>
+rpc::json_writer<Buffer>&
+rpc::json_writer<Buffer>::escaped(const char* data, size_t length) {
+	escape(data, length);
+	return *this;
+}
+
+template<typename Buffer>
+template<typename T>
+rpc::json_writer<Buffer>&
+rpc::json_writer<Buffer>::field(const char* name, const T& field_value) {
+	return key(name).value(field_value);
+}
+
+/*
+========================================================================================================
+	Helpers
+========================================================================================================
+*/
+
+template<typename Buffer>
+void
+rpc::json_writer<Buffer>::separator() {
+	uint64_t mask = (1ULL << m_depth);
+	if(m_firstElement & mask)
+		m_firstElement &= ~mask;
+	else
+		m_buffer.push_back(',');
+}
+
+template<typename Buffer>
+void
+rpc::json_writer<Buffer>::integer(uint64_t number, bool negative) {
+	char digits[21];
+	char* cursor = digits + sizeof(digits);
+	do {
+		*--cursor = '0' + (char)(number % 10);
+		number /= 10;
+	} while(number != 0);
+
+	if(negative)
+		*--cursor = '-';
+
+	m_buffer.append(cursor, (int)(digits + sizeof(digits) - cursor));
+}
+
+template<typename Buffer>
+void
+rpc::json_writer<Buffer>::escape(const char* data, size_t length) {
+	static const char hex[] = "0123456789abcdef";
+
+	// Same escaping rules as the Qt JSON writer, UTF-8 sequences are copied as is
+	const char* run = data;
+	const char* end = data + length;
+	for(const char* cursor = data; cursor < end; cursor++) {
+		unsigned char c = (unsigned char)*cursor;
+		if(c >= 0x20 && c != '"' && c != '\\')
+			continue;
+
+		if(cursor > run)
+			m_buffer.append(run, (int)(cursor - run));
+		run = cursor + 1;
+
+		char escaped[6] = { '\\', 0, 0, 0, 0, 0 };
+		int escaped_length = 2;
+		switch(c) {
+			case '"': escaped[1] = '"'; break;
+			case '\\': escaped[1] = '\\'; break;
+			case '\b': escaped[1] = 'b'; break;
+			case '\f': escaped[1] = 'f'; break;
+			case '\n': escaped[1] = 'n'; break;
+			case '\r': escaped[1] = 'r'; break;
+			case '\t': escaped[1] = 't'; break;
+			default:
+				escaped[1] = 'u';
+				escaped[2] = '0';
+				escaped[3] = '0';
+				escaped[4] = hex[c >> 4];
+				escaped[5] = hex[c & 0x0F];
+				escaped_length = 6;
+				break;
+		}
+		m_buffer.append(escaped, escaped_length);
+	}
+
+	if(end > run)
+		m_buffer.append(run, (int)(end - run));
+}
\ No newline at end of file
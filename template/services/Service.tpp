@@ -32,93 +32,46 @@ ServiceImpl<T>::~ServiceImpl() {
 template<typename T>
 void
 ServiceImpl<T>::setupEvent(obs::frontend::event event, obs_frontend_callback handler) {
-	this->EventObserver<T, obs::frontend::event>::registerCallback(
-		event,
-		(obs_frontend_callback)handler, 
-		reinterpret_cast<T*>(this)
-	);
-	_obs_manager->addEventHandler(event, this);
+	_obs_manager->addEventHandler(event, EventSlot<obs::frontend::event>(static_cast<T*>(this), handler));
 }
 
 template<typename T>
 void
 ServiceImpl<T>::setupEvent(obs::save::event event, obs_save_callback handler) {
-	this->EventObserver<T, obs::save::event>::registerCallback<const obs::save::data&>(
-		event,
-		(obs_save_callback)handler,
-		reinterpret_cast<T*>(this)
-	);
-	_obs_manager->addEventHandler(event, this);
+	_obs_manager->addEventHandler(event, EventSlot<obs::save::event>(static_cast<T*>(this), handler));
 }
 
 template<typename T>
 void
 ServiceImpl<T>::setupEvent(obs::output::event event, obs_output_callback handler) {
-	this->EventObserver<T, obs::output::event>::registerCallback<const obs::output::data&>(
-		event,
-		(obs_output_callback)handler,
-		reinterpret_cast<T*>(this)
-	);
-	_obs_manager->addEventHandler(event, this);
+	_obs_manager->addEventHandler(event, EventSlot<obs::output::event>(static_cast<T*>(this), handler));
 }
 
 template<typename T>
 void
 ServiceImpl<T>::setupEvent(obs::item::event event, obs_item_callback handler) {
-	this->EventObserver<T, obs::item::event>::registerCallback<const obs::item::data&>(
-		event,
-		(obs_item_callback)handler,
-		reinterpret_cast<T*>(this)
-	);
-	_obs_manager->addEventHandler(event, this);
+	_obs_manager->addEventHandler(event, EventSlot<obs::item::event>(static_cast<T*>(this), handler));
 }
 
 template<typename T>
 void
 ServiceImpl<T>::setupEvent(obs::source::event event, obs_source_callback handler) {
-	this->EventObserver<T, obs::source::event>::registerCallback<const obs::source::data&>(
-		event,
-		(obs_source_callback)handler,
-		reinterpret_cast<T*>(this)
-		);
-	_obs_manager->addEventHandler(event, this);
+	_obs_manager->addEventHandler(event, EventSlot<obs::source::event>(static_cast<T*>(this), handler));
 }
 
 template<typename T>
 void
 ServiceImpl<T>::setupEvent(obs::scene::event event, obs_scene_callback handler) {
-	this->EventObserver<T, obs::scene::event>::registerCallback<const obs::scene::data&>(
-		event,
-		(obs_scene_callback)handler,
-		reinterpret_cast<T*>(this)
-		);
-	_obs_manager->addEventHandler(event, this);
+	_obs_manager->addEventHandler(event, EventSlot<obs::scene::event>(static_cast<T*>(this), handler));
 }
 
 template<typename T>
 void
-ServiceImpl<T>::setupEvent(rpc::event, rpc_callback_void handler) {
+ServiceImpl<T>::setupEvent(rpc::event event, rpc_callback handler) {
 	if(_streamdeck_manager == nullptr)
 		return;
 
-	_rpcEvent.registerCallback(
-		event, 
-		(RPCHandler::FuncWrapperB<void>::Callback)handler, reinterpret_cast<T*>(this)
-	);
-	_streamdeck_manager->addEventHandler(event, &m_rpcEvent);
-}
-
-template<typename T>
-void
-ServiceImpl<T>::setupEvent(rpc::event event, rpc_callback_typed handler) {
-	if(_streamdeck_manager == nullptr)
-		return;
-
-	m_rpcEvent.registerCallback<const rpc::request&>(
-		event, 
-		(RPCHandler::FuncWrapperB<const rpc::request&>::Callback)handler, reinterpret_cast<T*>(this)
-	);
-	_streamdeck_manager->addEventHandler(event, &m_rpcEvent);
+	_streamdeck_manager->addEventHandler(event, EventSlot<rpc::event>(static_cast<T*>(this), handler));
 }
 
 /*
@@ -274,6 +227,16 @@ ServiceImpl<T>::response_sources(const rpc::request* data, const char* method) c
 	};
 }
 
+template<typename T>
+rpc::response<Revision>
+ServiceImpl<T>::response_revision(const rpc::request* data, const char* method) const {
+	return
+		rpc::response<Revision>{
+			{data, rpc::event::NO_EVENT, name(), method},
+			{ 0, 0 }
+	};
+}
+
 /*
 ========================================================================================================
 	Accessors
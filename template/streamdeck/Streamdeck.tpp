@@ -80,6 +80,19 @@ Streamdeck::sendEvent(const rpc::event event, const T& data, bool event_mode) {
 	return converted;
 }
 
+template<typename T>
+rpc::frame
+Streamdeck::renderEvent(const T& data) {
+	QJsonObject response = buildJsonResult(rpc::event::NO_EVENT, "");
+
+	if(!rpc2json(response, data))
+		return rpc::frame();
+
+	// resourceId is the last key of the last object, its value is spliced before the final "}}
+	QByteArray bytes = QJsonDocument(response).toJson(QJsonDocument::JsonFormat::Compact).append('\n');
+	return rpc::frame(bytes, bytes.size() - 4);
+}
+
 template<typename T>
 bool
 Streamdeck::sendResult(
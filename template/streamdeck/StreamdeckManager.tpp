@@ -7,6 +7,7 @@
  * Plugin Includes
  */
 #include "include/streamdeck/StreamdeckManager.hpp"
+#include "include/common/Logger.hpp"
 
 /*
 ========================================================================================================
@@ -40,6 +41,21 @@ StreamdeckManager::setEvent(Streamdeck* client, const rpc::response<void>& respo
 	return client->sendEvent(response.event);
 }
 
+template<typename T>
+bool
+StreamdeckManager::renderEvent(const rpc::response<T>& response, rpc::frame& frame) {
+	frame = Streamdeck::renderEvent(response.data);
+	return !frame.empty();
+}
+
+template<>
+inline bool
+StreamdeckManager::renderEvent(const rpc::response<void>& response, rpc::frame& frame) {
+	Q_UNUSED(response);
+	frame = Streamdeck::renderEvent();
+	return !frame.empty();
+}
+
 /*
 ========================================================================================================
 	Messages Handling
@@ -95,6 +111,87 @@ StreamdeckManager::commit_all(
 	return result;
 }
 
+template<typename T>
+bool
+StreamdeckManager::commit_all(
+	rpc::response<T>& response,
+	bool(StreamdeckManager::*renderer)(const rpc::response<T>&, rpc::frame&)
+) {
+	bool result = this->validate(response);
+
+	if(m_streamdecks.isEmpty())
+		return result;
+
+	// The payload is serialized once, every client shares the same bytes
+	rpc::frame frame;
+	bool rendered = (this->*renderer)(response, frame);
+
+	for(auto i = m_streamdecks.begin(); i != m_streamdecks.end();) {
+		Streamdeck* client = *i;
+		++i;
+
+		// Clients following deltas already received the change
+		if(response.request == nullptr && client->supersededByDeltas(response.event))
+			continue;
+
+		if(!rendered || !client->sendFrame(response.event, frame)) {
+			this->close(client);
+			result = false;
+		}
+	}
+
+	return result;
+}
+
+template<typename T, typename Loader>
+bool
+StreamdeckManager::commit_cached(
+	rpc::response<T>& response,
+	bool(StreamdeckManager::*renderer)(const rpc::response<T>&, rpc::frame&),
+	uint16_t key,
+	uint64_t version,
+	Loader loader
+) {
+	if(response.request == nullptr || response.request->client == nullptr)
+		return false;
+
+	if(!validate(response))
+		return false;
+
+	// The answer only depends on the model version and on the resource the client asked with
+	CacheKey cache_key(response.event, key, formatResource(response).toStdString());
+	CachedResponse& cached = m_responseCache[cache_key];
+	if(!cached.frame.empty() && cached.version == version) {
+		m_cacheHits++;
+	}
+	else {
+		m_cacheMisses++;
+		response.data = loader();
+		rpc::frame frame;
+		if(!(this->*renderer)(response, frame)) {
+			m_responseCache.erase(cache_key);
+			this->close(response.request->client);
+			return false;
+		}
+		cached.version = version;
+		cached.frame = frame;
+
+		log_custom(LOG_STREAMDECK_MANAGER) << QString("[Streamdeck Manager] Response cache : "
+			"%1 hits, %2 misses.").arg(m_cacheHits).arg(m_cacheMisses).toStdString() << log_end;
+	}
+
+	// A reply must not be merged with a pending one, it may target another collection
+	Streamdeck* client = response.request->client;
+	rpc::frame reply(cached.frame.data(), cached.frame.splice());
+	bool result = client->sendFrame(response.event, reply);
+
+	if(!result) {
+		this->close(client);
+	}
+
+	return result;
+}
+
 template<typename T>
 bool
 StreamdeckManager::commit_any(
@@ -0,0 +1,58 @@
+/*
+ * Std Includes
+ */
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+/*
+ * Plugin Includes
+ */
+#include "Allocations.hpp"
+
+/*
+========================================================================================================
+	Allocations Counter
+========================================================================================================
+*/
+
+static std::atomic<size_t> _allocations(0);
+
+size_t
+countedAllocations() {
+	return _allocations.load(std::memory_order_relaxed);
+}
+
+void*
+operator new(size_t size) {
+	_allocations.fetch_add(1, std::memory_order_relaxed);
+	void* pointer = malloc(size > 0 ? size : 1);
+	if(pointer == nullptr)
+		throw std::bad_alloc();
+	return pointer;
+}
+
+void*
+operator new[](size_t size) {
+	return operator new(size);
+}
+
+void
+operator delete(void* pointer) noexcept {
+	free(pointer);
+}
+
+void
+operator delete[](void* pointer) noexcept {
+	free(pointer);
+}
+
+void
+operator delete(void* pointer, size_t) noexcept {
+	free(pointer);
+}
+
+void
+operator delete[](void* pointer, size_t) noexcept {
+	free(pointer);
+}
\ No newline at end of file
@@ -0,0 +1,16 @@
+#pragma once
+
+/*
+ * Std Includes
+ */
+#include <cstddef>
+
+/*
+========================================================================================================
+	Functions
+========================================================================================================
+*/
+
+// Global operator new calls since the start of the test, tests linking Allocations.cpp only
+size_t
+countedAllocations();
\ No newline at end of file
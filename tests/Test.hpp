@@ -0,0 +1,84 @@
+#pragma once
+
+/*
+ * Std Includes
+ */
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+
+/*
+========================================================================================================
+	Defines
+========================================================================================================
+*/
+
+// A failed check ends the test, ctest reports the line
+#define test_assert(condition) \
+	do { \
+		if(!(condition)) { \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+			exit(EXIT_FAILURE); \
+		} \
+	} while(0)
+
+/*
+========================================================================================================
+	Types Definitions
+========================================================================================================
+*/
+
+/*
+ * Wall clock of a benchmark. Results are printed per operation, the absolute numbers only mean
+ * something against the baseline measured by the same run.
+ */
+class Stopwatch {
+
+	/*
+	====================================================================================================
+		Instance Data Members
+	====================================================================================================
+	*/
+	private:
+
+		std::chrono::steady_clock::time_point m_start;
+
+	/*
+	====================================================================================================
+		Constructors / Destructor
+	====================================================================================================
+	*/
+	public:
+
+		Stopwatch() :
+			m_start(std::chrono::steady_clock::now()) {
+		}
+
+	/*
+	====================================================================================================
+		Instance Methods
+	====================================================================================================
+	*/
+	public:
+
+		void
+		restart() {
+			m_start = std::chrono::steady_clock::now();
+		}
+
+		double
+		elapsed() const {
+			return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_start).count();
+		}
+
+		// Prints the elapsed time, in total and per operation
+		double
+		report(const char* name, size_t operations) const {
+			double milliseconds = elapsed();
+			printf("%-48s %10.2f ms %12.1f ns/op\n", name, milliseconds,
+				operations > 0 ? milliseconds * 1e6 / operations : 0.0);
+			return milliseconds;
+		}
+
+};
\ No newline at end of file
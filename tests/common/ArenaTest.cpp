@@ -0,0 +1,125 @@
+/*
+ * Std Includes
+ */
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/*
+ * Plugin Includes
+ */
+#include "include/common/Arena.hpp"
+#include "Allocations.hpp"
+#include "Test.hpp"
+
+/*
+========================================================================================================
+	Defines
+========================================================================================================
+*/
+
+#define ARENA_BENCH_ITEMS 5000
+
+#define ARENA_BENCH_ROUNDS 20
+
+/*
+========================================================================================================
+	Fixtures
+========================================================================================================
+*/
+
+// Roughly the footprint of an Item: identifiers, flags and references to its scene and source
+typedef struct BenchItem {
+	uint16_t id;
+	uint32_t handle;
+	bool visible;
+	void* scene;
+	void* source;
+	std::shared_ptr<void> reference;
+} BenchItem;
+
+/*
+========================================================================================================
+	Tests
+========================================================================================================
+*/
+
+static void
+testArena() {
+	Arena arena;
+
+	// Chunks are aligned, freed chunks are reused by the next allocation of their size
+	void* first = arena.allocate(24);
+	void* second = arena.allocate(3);
+	test_assert(reinterpret_cast<uintptr_t>(first) % alignof(std::max_align_t) == 0);
+	test_assert(reinterpret_cast<uintptr_t>(second) % alignof(std::max_align_t) == 0);
+	test_assert(first != second && arena.blocks() == 1);
+
+	arena.deallocate(first, 24);
+	test_assert(arena.allocate(20) == first);
+
+	// Oversized requests get their own block
+	arena.allocate(ARENA_BLOCK_SIZE);
+	test_assert(arena.blocks() == 2);
+
+	// Objects outlive the owner of their arena
+	std::shared_ptr<BenchItem> item;
+	{
+		std::shared_ptr<Arena> shared = std::make_shared<Arena>();
+		item = std::allocate_shared<BenchItem>(ArenaAllocator<BenchItem>(shared));
+		item->id = 7;
+	}
+	test_assert(item->id == 7);
+}
+
+/*
+========================================================================================================
+	Benchmarks
+========================================================================================================
+*/
+
+static void
+benchCollection() {
+	size_t heap_allocations = 0;
+	size_t arena_allocations = 0;
+
+	// Former model: every object and its control block is a heap allocation, freed one by one
+	Stopwatch watch;
+	for(int round = 0; round < ARENA_BENCH_ROUNDS; round++) {
+		std::vector<std::shared_ptr<BenchItem>> items;
+		items.reserve(ARENA_BENCH_ITEMS);
+		size_t before = countedAllocations();
+		for(uint16_t i = 0; i < ARENA_BENCH_ITEMS; i++)
+			items.push_back(std::make_shared<BenchItem>());
+		heap_allocations = countedAllocations() - before;
+	}
+	watch.report("5k items load/unload, heap", ARENA_BENCH_ROUNDS);
+
+	watch.restart();
+	for(int round = 0; round < ARENA_BENCH_ROUNDS; round++) {
+		std::shared_ptr<Arena> arena = std::make_shared<Arena>();
+		std::vector<std::shared_ptr<BenchItem>> items;
+		items.reserve(ARENA_BENCH_ITEMS);
+		size_t before = countedAllocations();
+		for(uint16_t i = 0; i < ARENA_BENCH_ITEMS; i++)
+			items.push_back(std::allocate_shared<BenchItem>(ArenaAllocator<BenchItem>(arena)));
+		arena_allocations = countedAllocations() - before;
+	}
+	watch.report("5k items load/unload, arena", ARENA_BENCH_ROUNDS);
+
+	printf("5k items heap allocations: %zu heap, %zu arena\n", heap_allocations, arena_allocations);
+	test_assert(arena_allocations < heap_allocations / 10);
+}
+
+/*
+========================================================================================================
+	Entry Point
+========================================================================================================
+*/
+
+int
+main() {
+	testArena();
+	benchCollection();
+	return EXIT_SUCCESS;
+}
\ No newline at end of file
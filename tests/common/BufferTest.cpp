@@ -0,0 +1,179 @@
+/*
+ * Std Includes
+ */
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/*
+ * Plugin Includes
+ */
+#include "include/common/Buffer.hpp"
+#include "Test.hpp"
+
+/*
+========================================================================================================
+	Defines
+========================================================================================================
+*/
+
+#define BUFFER_BENCH_SCENES 500
+
+#define BUFFER_BENCH_ITEMS 50
+
+#define BUFFER_BENCH_ROUNDS 20
+
+/*
+========================================================================================================
+	Tests
+========================================================================================================
+*/
+
+static void
+testRoundTrip() {
+	Buffer buffer;
+	BufferWriter writer(buffer);
+	writer.write<uint16_t>(0xBEEF).write<int32_t>(-2).write<uint64_t>(0x0102030405060708ULL);
+	writer.write(std::string("Scene \"1\""));
+	size_t block = writer.beginBlock();
+	writer.write<uint8_t>(1).write<uint8_t>(2);
+	writer.endBlock(block);
+
+	// Values are little endian whatever the host
+	test_assert(static_cast<uint8_t>(buffer.data()[0]) == 0xEF && static_cast<uint8_t>(buffer.data()[1]) == 0xBE);
+
+	BufferReader reader(buffer);
+	uint16_t u16 = 0;
+	int32_t i32 = 0;
+	uint64_t u64 = 0;
+	std::string string;
+	size_t block_size = 0;
+	uint8_t first = 0, second = 0;
+	test_assert(reader.read(u16) && u16 == 0xBEEF);
+	test_assert(reader.read(i32) && i32 == -2);
+	test_assert(reader.read(u64) && u64 == 0x0102030405060708ULL);
+	test_assert(reader.read(string) && string == "Scene \"1\"");
+	test_assert(reader.read(block_size) && block_size == 2);
+	test_assert(reader.read(first) && reader.read(second) && first == 1 && second == 2);
+	test_assert(reader.remaining() == 0 && !reader.failed());
+
+	// Running out of bytes fails the reader for good
+	test_assert(!reader.read(first));
+	test_assert(reader.failed());
+	BufferReader truncated(buffer.data(), 3);
+	test_assert(!truncated.read(u64) && !truncated.read(first));
+	BufferReader empty(nullptr, 16);
+	test_assert(empty.remaining() == 0 && !empty.read(first));
+
+	// A length beyond the data doesn't read past it
+	Buffer lying;
+	BufferWriter(lying).write<unsigned int>(1000).write<uint8_t>(0);
+	BufferReader lying_reader(lying);
+	test_assert(!lying_reader.read(string));
+
+	// Moving hands the block over
+	const byte* data = buffer.data();
+	Buffer moved(std::move(buffer));
+	test_assert(moved.data() == data && buffer.size() == 0 && buffer.data() == nullptr);
+}
+
+/*
+========================================================================================================
+	Benchmarks
+========================================================================================================
+*/
+
+static void
+benchSerialization() {
+	const std::string name = "Scene name of average length";
+	size_t copied_before = 0;
+	size_t copied_after = 0;
+	size_t size_before = 0;
+	size_t size_after = 0;
+
+	// Former Memory path: one block per child, copied into its parent once all are built
+	Stopwatch watch;
+	for(int round = 0; round < BUFFER_BENCH_ROUNDS; round++) {
+		copied_before = 0;
+		std::vector<std::vector<byte>> scenes;
+		for(int i = 0; i < BUFFER_BENCH_SCENES; i++) {
+			std::vector<std::vector<byte>> items;
+			for(int j = 0; j < BUFFER_BENCH_ITEMS; j++) {
+				std::vector<byte> item(sizeof(uint16_t) * 2 + sizeof(bool));
+				memcpy(item.data(), &j, sizeof(uint16_t));
+				items.push_back(std::move(item));
+			}
+			size_t total = sizeof(unsigned int) + name.size();
+			for(auto iter = items.begin(); iter != items.end(); iter++)
+				total += iter->size();
+			std::vector<byte> scene(total);
+			memcpy(scene.data() + sizeof(unsigned int), name.data(), name.size());
+			size_t offset = sizeof(unsigned int) + name.size();
+			for(auto iter = items.begin(); iter != items.end(); iter++) {
+				memcpy(scene.data() + offset, iter->data(), iter->size());
+				offset += iter->size();
+				copied_before += iter->size();
+			}
+			scenes.push_back(std::move(scene));
+		}
+		size_t total = 0;
+		for(auto iter = scenes.begin(); iter != scenes.end(); iter++)
+			total += iter->size();
+		std::vector<byte> collection(total);
+		size_t offset = 0;
+		for(auto iter = scenes.begin(); iter != scenes.end(); iter++) {
+			memcpy(collection.data() + offset, iter->data(), iter->size());
+			offset += iter->size();
+			copied_before += iter->size();
+		}
+		size_before = collection.size();
+	}
+	watch.report("collection 500x50, child blocks", BUFFER_BENCH_ROUNDS);
+
+	// Single pass, the only copies are the ones of the buffer outgrowing its block
+	watch.restart();
+	for(int round = 0; round < BUFFER_BENCH_ROUNDS; round++) {
+		copied_after = 0;
+		Buffer buffer;
+		BufferWriter writer(buffer);
+		size_t capacity = buffer.capacity();
+		auto track = [&buffer, &capacity, &copied_after](size_t before) {
+			if(buffer.capacity() != capacity) {
+				copied_after += before;
+				capacity = buffer.capacity();
+			}
+		};
+		for(int i = 0; i < BUFFER_BENCH_SCENES; i++) {
+			size_t before = buffer.size();
+			size_t block = writer.beginBlock();
+			writer.write(name);
+			track(before);
+			for(int j = 0; j < BUFFER_BENCH_ITEMS; j++) {
+				before = buffer.size();
+				writer.write<uint16_t>((uint16_t)j).write<uint16_t>(0).write<uint8_t>(1);
+				track(before);
+			}
+			writer.endBlock(block);
+		}
+		size_after = buffer.size();
+	}
+	watch.report("collection 500x50, single pass", BUFFER_BENCH_ROUNDS);
+
+	printf("collection 500x50 bytes copied: %zu before, %zu after (%zu / %zu bytes written)\n",
+		copied_before, copied_after, size_before, size_after);
+	test_assert(copied_after < copied_before);
+}
+
+/*
+========================================================================================================
+	Entry Point
+========================================================================================================
+*/
+
+int
+main() {
+	testRoundTrip();
+	benchSerialization();
+	return EXIT_SUCCESS;
+}
\ No newline at end of file
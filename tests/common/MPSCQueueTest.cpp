@@ -0,0 +1,129 @@
+/*
+ * Std Includes
+ */
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+/*
+ * Plugin Includes
+ */
+#include "include/common/MPSCQueue.hpp"
+#include "Test.hpp"
+
+/*
+========================================================================================================
+	Defines
+========================================================================================================
+*/
+
+#define MPSC_QUEUE_TEST_PRODUCERS 4
+
+#define MPSC_QUEUE_TEST_VALUES 200000
+
+#define MPSC_QUEUE_TEST_CAPACITY 256
+
+/*
+========================================================================================================
+	Types Definitions
+========================================================================================================
+*/
+
+typedef struct Value {
+	size_t producer = 0;
+	size_t sequence = 0;
+} Value;
+
+/*
+========================================================================================================
+	Tests
+========================================================================================================
+*/
+
+static void
+testOrder() {
+	MPSCQueue<Value> queue(2);
+	Value value;
+	test_assert(queue.empty() && !queue.pop(value));
+
+	// The third value finds the ring full and spills once its producer gave up waiting
+	for(size_t i = 0; i < 3; i++)
+		queue.push(Value { 0, i }, std::chrono::milliseconds(1));
+	test_assert(queue.size() == 3 && queue.spilled() == 1);
+
+	// The ring doesn't take values ahead of the spilled ones
+	test_assert(queue.pop(value) && value.sequence == 0);
+	value = Value { 0, 3 };
+	test_assert(!queue.tryPush(value));
+	queue.push(std::move(value), std::chrono::milliseconds(0));
+
+	for(size_t i = 1; i < 4; i++)
+		test_assert(queue.pop(value) && value.sequence == i);
+	test_assert(queue.empty() && !queue.pop(value));
+
+	value = Value { 0, 4 };
+	test_assert(queue.tryPush(value) && queue.pop(value) && value.sequence == 4);
+}
+
+/*
+========================================================================================================
+	Benchmarks
+========================================================================================================
+*/
+
+static void
+benchProducers() {
+	// Producers push concurrently with the single consumer, every value comes out once and in the
+	// order of its producer. The ring is small, they keep waiting on the consumer for room
+	MPSCQueue<Value> queue(MPSC_QUEUE_TEST_CAPACITY);
+	std::atomic<size_t> running(MPSC_QUEUE_TEST_PRODUCERS);
+	std::vector<std::thread> producers;
+
+	Stopwatch watch;
+	for(size_t producer = 0; producer < MPSC_QUEUE_TEST_PRODUCERS; producer++) {
+		producers.emplace_back([&queue, &running, producer]() {
+			for(size_t sequence = 0; sequence < MPSC_QUEUE_TEST_VALUES; sequence++)
+				queue.push(Value { producer, sequence }, std::chrono::milliseconds(100));
+			running--;
+		});
+	}
+
+	std::vector<size_t> expected(MPSC_QUEUE_TEST_PRODUCERS, 0);
+	size_t popped = 0;
+	Value value;
+	while(true) {
+		bool done = running == 0;
+		while(queue.pop(value)) {
+			test_assert(value.producer < MPSC_QUEUE_TEST_PRODUCERS);
+			test_assert(value.sequence == expected[value.producer]);
+			expected[value.producer]++;
+			popped++;
+		}
+		if(done)
+			break;
+		std::this_thread::yield();
+	}
+	watch.report("MPSCQueue push/pop, 4 producers", popped);
+	printf("%-48s %10zu\n", "MPSCQueue values spilled", queue.spilled());
+
+	for(auto iter = producers.begin(); iter != producers.end(); iter++)
+		iter->join();
+
+	test_assert(popped == MPSC_QUEUE_TEST_PRODUCERS * MPSC_QUEUE_TEST_VALUES);
+	test_assert(queue.empty());
+}
+
+/*
+========================================================================================================
+	Entry Point
+========================================================================================================
+*/
+
+int
+main() {
+	testOrder();
+	benchProducers();
+	return EXIT_SUCCESS;
+}
\ No newline at end of file
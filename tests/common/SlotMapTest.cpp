@@ -0,0 +1,107 @@
+/*
+ * Std Includes
+ */
+#include <memory>
+#include <vector>
+
+/*
+ * Plugin Includes
+ */
+#include "include/common/SlotMap.hpp"
+#include "Test.hpp"
+
+/*
+========================================================================================================
+	Defines
+========================================================================================================
+*/
+
+#define SLOT_MAP_BENCH_OBJECTS 20000
+
+#define SLOT_MAP_BENCH_LOOKUPS 20000000
+
+/*
+========================================================================================================
+	Tests
+========================================================================================================
+*/
+
+static void
+testHandles() {
+	int objects[3] = { 0, 1, 2 };
+	SlotMap<int> slots;
+
+	Handle<int> first = slots.insert(&objects[0]);
+	Handle<int> second = slots.insert(&objects[1]);
+	test_assert(!first.empty() && first != second);
+	test_assert(slots.get(first) == &objects[0] && slots.get(second) == &objects[1]);
+	test_assert(slots.get(Handle<int>()) == nullptr);
+
+	// A freed slot is reused under a new generation, its former handles are stale
+	test_assert(slots.erase(first));
+	test_assert(!slots.erase(first));
+	test_assert(slots.get(first) == nullptr);
+	Handle<int> third = slots.insert(&objects[2]);
+	test_assert(third.index() == first.index() && third.generation() != first.generation());
+	test_assert(slots.get(first) == nullptr && slots.get(third) == &objects[2]);
+	test_assert(slots.size() == 2);
+
+	// Clearing invalidates every handle at once
+	slots.clear();
+	test_assert(slots.size() == 0);
+	test_assert(slots.get(second) == nullptr && slots.get(third) == nullptr);
+
+	// Handles never outgrow their 16 bits index
+	std::vector<int> many(SLOT_MAP_MAX_SIZE + 1);
+	size_t inserted = 0;
+	for(auto iter = many.begin(); iter != many.end(); iter++)
+		inserted += slots.insert(&(*iter)).empty() ? 0 : 1;
+	test_assert(inserted == SLOT_MAP_MAX_SIZE);
+}
+
+/*
+========================================================================================================
+	Benchmarks
+========================================================================================================
+*/
+
+static void
+benchLookups() {
+	// The model used to hand out shared objects, a holder checked them through weak references
+	std::vector<std::shared_ptr<int>> shared;
+	std::vector<std::weak_ptr<int>> weak;
+	std::vector<int> objects(SLOT_MAP_BENCH_OBJECTS);
+	SlotMap<int> slots;
+	std::vector<Handle<int>> handles;
+	for(size_t i = 0; i < SLOT_MAP_BENCH_OBJECTS; i++) {
+		shared.push_back(std::make_shared<int>((int)i));
+		weak.push_back(shared.back());
+		handles.push_back(slots.insert(&objects[i]));
+	}
+
+	size_t found = 0;
+	Stopwatch watch;
+	for(size_t i = 0; i < SLOT_MAP_BENCH_LOOKUPS; i++)
+		found += weak[(i * 7919) % SLOT_MAP_BENCH_OBJECTS].lock() != nullptr;
+	watch.report("weak_ptr lock", SLOT_MAP_BENCH_LOOKUPS);
+
+	watch.restart();
+	for(size_t i = 0; i < SLOT_MAP_BENCH_LOOKUPS; i++)
+		found -= slots.get(handles[(i * 7919) % SLOT_MAP_BENCH_OBJECTS]) != nullptr;
+	watch.report("SlotMap get", SLOT_MAP_BENCH_LOOKUPS);
+
+	test_assert(found == 0);
+}
+
+/*
+========================================================================================================
+	Entry Point
+========================================================================================================
+*/
+
+int
+main() {
+	testHandles();
+	benchLookups();
+	return EXIT_SUCCESS;
+}
\ No newline at end of file
@@ -0,0 +1,147 @@
+/*
+ * Std Includes
+ */
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * Plugin Includes
+ */
+#include "include/common/WorkerPool.hpp"
+#include "Test.hpp"
+
+/*
+========================================================================================================
+	Defines
+========================================================================================================
+*/
+
+#define POOL_BENCH_COLLECTIONS 50
+
+#define POOL_BENCH_SCENES 200
+
+/*
+========================================================================================================
+	Fixtures
+========================================================================================================
+*/
+
+// Stands for the parsing of one collection file: builds and scans its scene names
+static size_t
+parseCollection(size_t collection) {
+	size_t checksum = 0;
+	std::string document;
+	for(size_t scene = 0; scene < POOL_BENCH_SCENES; scene++) {
+		document.clear();
+		for(size_t item = 0; item < 50; item++)
+			document.append("{\"name\":\"Item ").append(std::to_string(collection * scene + item)).append("\"},");
+		for(auto iter = document.begin(); iter != document.end(); iter++)
+			checksum = checksum * 31 + static_cast<unsigned char>(*iter);
+	}
+	return checksum;
+}
+
+/*
+========================================================================================================
+	Tests
+========================================================================================================
+*/
+
+static void
+testBatches() {
+	WorkerPool pool(4);
+	test_assert(pool.workers() == 4);
+
+	// The same threads serve every batch, of any size
+	for(size_t count = 0; count < 200; count++) {
+		std::vector<std::atomic<int>> runs(count);
+		pool.run(count, [&runs](size_t index) { runs[index]++; });
+		for(size_t i = 0; i < count; i++)
+			test_assert(runs[i] == 1);
+	}
+
+	// The first failure is rethrown once the batch is over, the pool stays usable
+	std::atomic<size_t> done(0);
+	bool thrown = false;
+	try {
+		pool.run(100, [&done](size_t index) {
+			if(index == 37)
+				throw std::runtime_error("task failed");
+			done++;
+		});
+	}
+	catch(const std::runtime_error&) {
+		thrown = true;
+	}
+	test_assert(thrown && done == 99);
+
+	done = 0;
+	pool.run(10, [&done](size_t) { done++; });
+	test_assert(done == 10);
+
+	test_assert(WorkerPool(WORKER_POOL_MAX_SIZE * 2).workers() == WORKER_POOL_MAX_SIZE);
+	test_assert(WorkerPool().workers() >= 1);
+}
+
+/*
+========================================================================================================
+	Benchmarks
+========================================================================================================
+*/
+
+static void
+benchScaling() {
+	printf("%zu hardware threads\n", static_cast<size_t>(std::thread::hardware_concurrency()));
+
+	size_t expected = 0;
+	for(size_t workers = 1; workers <= WORKER_POOL_MAX_SIZE; workers *= 2) {
+		WorkerPool pool(workers);
+		std::vector<size_t> results(POOL_BENCH_COLLECTIONS);
+
+		Stopwatch watch;
+		pool.run(POOL_BENCH_COLLECTIONS, [&results](size_t index) { results[index] = parseCollection(index); });
+		std::string name = "50 collections on " + std::to_string(workers) + " workers";
+		watch.report(name.c_str(), POOL_BENCH_COLLECTIONS);
+
+		size_t checksum = 0;
+		for(auto iter = results.begin(); iter != results.end(); iter++)
+			checksum ^= *iter;
+		if(workers == 1)
+			expected = checksum;
+		test_assert(checksum == expected);
+	}
+
+	// Batches reuse the threads instead of starting them
+	WorkerPool pool(8);
+	std::atomic<size_t> total(0);
+	Stopwatch watch;
+	for(int i = 0; i < 5000; i++)
+		pool.run(16, [&total](size_t index) { total += index; });
+	watch.report("5000 batches of 16 tasks, 8 persistent workers", 5000);
+
+	watch.restart();
+	for(int i = 0; i < 5000; i++) {
+		std::vector<std::thread> threads;
+		for(size_t t = 1; t < 8; t++)
+			threads.emplace_back([&total]() { total++; });
+		for(auto iter = threads.begin(); iter != threads.end(); iter++)
+			iter->join();
+	}
+	watch.report("5000 batches, 8 threads started per batch", 5000);
+}
+
+/*
+========================================================================================================
+	Entry Point
+========================================================================================================
+*/
+
+int
+main() {
+	testBatches();
+	benchScaling();
+	return EXIT_SUCCESS;
+}
\ No newline at end of file
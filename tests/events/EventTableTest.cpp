@@ -0,0 +1,144 @@
+/*
+ * Std Includes
+ */
+#include <cstdint>
+#include <vector>
+
+/*
+ * Plugin Includes
+ */
+#include "include/events/EventObservable.hpp"
+#include "Test.hpp"
+
+/*
+========================================================================================================
+	Defines
+========================================================================================================
+*/
+
+#define EVENT_BENCH_SERVICES 7
+
+#define EVENT_BENCH_NOTIFICATIONS 1000000
+
+/*
+========================================================================================================
+	Fixtures
+========================================================================================================
+*/
+
+// Same size as rpc::event, dispatched through the flat table
+enum class table_event {
+	FIRST = 0,
+	COUNT = 36,
+};
+
+// Same values, dispatched through the map as before
+enum class map_event {
+	FIRST = 0,
+	COUNT = 36,
+};
+
+template<>
+struct event_traits<table_event> {
+	static constexpr bool bounded = true;
+	static constexpr size_t size = static_cast<size_t>(table_event::COUNT);
+	typedef const uint64_t& payload;
+};
+
+template<>
+struct event_traits<map_event> {
+	static constexpr bool bounded = false;
+	static constexpr size_t size = 0;
+	typedef const uint64_t& payload;
+};
+
+// Stands for a service, every one of them observes every event
+class BenchService {
+
+	public:
+
+		uint64_t m_received = 0;
+
+		bool
+		onEvent(const uint64_t& value) {
+			m_received += value;
+			return true;
+		}
+
+};
+
+template<typename T>
+static void
+registerServices(EventObservable<T>& observable, std::vector<BenchService>& services) {
+	for(size_t event = 0; event < static_cast<size_t>(T::COUNT); event++) {
+		observable.addEvent(static_cast<T>(event));
+		for(auto iter = services.begin(); iter != services.end(); iter++)
+			observable.addEventHandler(static_cast<T>(event), EventSlot<T>(&(*iter), &BenchService::onEvent));
+	}
+}
+
+/*
+========================================================================================================
+	Tests
+========================================================================================================
+*/
+
+static void
+testDispatch() {
+	std::vector<BenchService> services(EVENT_BENCH_SERVICES);
+	EventObservable<table_event> observable;
+	registerServices(observable, services);
+
+	// A handler registered twice is only called once, an unregistered event reaches nobody
+	observable.addEventHandler(table_event::FIRST, EventSlot<table_event>(&services[0], &BenchService::onEvent));
+	test_assert(observable.notifyEvent(table_event::FIRST, (uint64_t)1));
+	for(auto iter = services.begin(); iter != services.end(); iter++)
+		test_assert(iter->m_received == 1);
+
+	observable.remEventHandler(table_event::FIRST, EventSlot<table_event>(&services[0], &BenchService::onEvent));
+	observable.notifyEvent(table_event::FIRST, (uint64_t)1);
+	test_assert(services[0].m_received == 1 && services[1].m_received == 2);
+
+	observable.removeEvent(static_cast<table_event>(3));
+	test_assert(!observable.notifyEvent(static_cast<table_event>(3), (uint64_t)1));
+	test_assert(!observable.notifyEvent(table_event::COUNT, (uint64_t)1));
+}
+
+/*
+========================================================================================================
+	Benchmarks
+========================================================================================================
+*/
+
+template<typename T>
+static uint64_t
+benchNotify(const char* name) {
+	std::vector<BenchService> services(EVENT_BENCH_SERVICES);
+	EventObservable<T> observable;
+	registerServices(observable, services);
+
+	Stopwatch watch;
+	for(uint64_t i = 0; i < EVENT_BENCH_NOTIFICATIONS; i++)
+		observable.notifyEvent(static_cast<T>(i % static_cast<uint64_t>(T::COUNT)), i);
+	watch.report(name, EVENT_BENCH_NOTIFICATIONS);
+
+	uint64_t received = 0;
+	for(auto iter = services.begin(); iter != services.end(); iter++)
+		received += iter->m_received;
+	return received;
+}
+
+/*
+========================================================================================================
+	Entry Point
+========================================================================================================
+*/
+
+int
+main() {
+	testDispatch();
+	uint64_t map_received = benchNotify<map_event>("notify 7 services, map");
+	uint64_t table_received = benchNotify<table_event>("notify 7 services, flat table");
+	test_assert(map_received == table_received);
+	return EXIT_SUCCESS;
+}
\ No newline at end of file
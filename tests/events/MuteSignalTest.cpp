@@ -0,0 +1,242 @@
+/*
+ * Std Includes
+ */
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+
+/*
+ * Plugin Includes
+ */
+#include "include/common/MPSCQueue.hpp"
+#include "Allocations.hpp"
+#include "Test.hpp"
+
+/*
+========================================================================================================
+	Defines
+========================================================================================================
+*/
+
+#define MUTE_BENCH_SIGNALS 100000
+
+// Signals emitted before the model thread wakes up and drains them
+#define MUTE_BENCH_BURST 64
+
+/*
+========================================================================================================
+	Fixtures
+========================================================================================================
+*/
+
+// Same layout as SignalRecord, without the OBS types
+typedef struct BenchRecord {
+	void (*dispatch)(BenchRecord& record, bool deliver);
+	void* trigger;
+	int event;
+	void* object;
+	void* reference;
+	union {
+		bool boolean_value;
+		int64_t int_value;
+		const char* state;
+	} value;
+	std::string string;
+} BenchRecord;
+
+// Stands for the calldata of a mute signal
+typedef struct BenchCalldata {
+	void* source;
+	bool muted;
+} BenchCalldata;
+
+static void
+DispatchRecord(BenchRecord& record, bool deliver) {
+	if(deliver)
+		(*reinterpret_cast<size_t*>(record.trigger)) += record.value.boolean_value ? 1 : 0;
+}
+
+// The former queue, a deque behind a mutex
+class DequeQueue {
+
+	private:
+
+		std::deque<BenchRecord> m_values;
+
+		std::mutex m_lock;
+
+	public:
+
+		void
+		push(BenchRecord&& value) {
+			std::lock_guard<std::mutex> lock(m_lock);
+			m_values.push_back(std::move(value));
+		}
+
+		bool
+		pop(BenchRecord& value) {
+			std::lock_guard<std::mutex> lock(m_lock);
+			if(m_values.empty())
+				return false;
+			value = std::move(m_values.front());
+			m_values.pop_front();
+			return true;
+		}
+
+};
+
+/*
+ * Source trigger reduced to its mute handler: it captures the signal into a record and queues it
+ * for the model thread.
+ */
+template<typename Q>
+class BenchTrigger {
+
+	public:
+
+		typedef void (BenchTrigger<Q>::*Handler)(BenchCalldata* data);
+
+		// Entry of the signal registry, the signal data OBS hands back
+		typedef struct Entry {
+			BenchTrigger<Q>* owner;
+			Handler handler;
+			const char* signal;
+		} Entry;
+
+		Q& m_queue;
+
+		size_t m_delivered;
+
+		std::function<void(void*, BenchCalldata*)> m_function;
+
+		Entry m_entry;
+
+	public:
+
+		explicit BenchTrigger(Q& queue) :
+			m_queue(queue),
+			m_delivered(0),
+			m_function(std::bind(&BenchTrigger<Q>::onMuteFunction, this, std::placeholders::_1, std::placeholders::_2)),
+			m_entry(Entry{ this, &BenchTrigger<Q>::onMute, "mute" }) {
+		}
+
+		// Former callback: the bound function is copied out of the signal data on every signal
+		static void
+		CallFunction(void* callback, BenchCalldata* data) {
+			typedef std::function<void(void*, BenchCalldata*)> func;
+			func function = *reinterpret_cast<func*>(callback);
+			function(data->source, data);
+		}
+
+		// Registry callback: one indirect member call
+		static void
+		CallEntry(void* entry, BenchCalldata* data) {
+			const Entry* entry_ref = reinterpret_cast<const Entry*>(entry);
+			(entry_ref->owner->*entry_ref->handler)(data);
+		}
+
+		void
+		onMuteFunction(void*, BenchCalldata* data) {
+			onMute(data);
+		}
+
+		void
+		onMute(BenchCalldata* data) {
+			BenchRecord record;
+			record.dispatch = DispatchRecord;
+			record.trigger = &m_delivered;
+			record.event = 0;
+			record.object = data->source;
+			record.reference = data->source;
+			record.value.boolean_value = data->muted;
+			push(std::move(record));
+		}
+
+		void
+		drain() {
+			BenchRecord record;
+			while(m_queue.pop(record))
+				record.dispatch(record, true);
+		}
+
+	private:
+
+		void
+		push(BenchRecord&& record);
+
+};
+
+template<>
+void
+BenchTrigger<DequeQueue>::push(BenchRecord&& record) {
+	m_queue.push(std::move(record));
+}
+
+template<>
+void
+BenchTrigger<MPSCQueue<BenchRecord>>::push(BenchRecord&& record) {
+	m_queue.push(std::move(record), std::chrono::milliseconds(50));
+}
+
+/*
+========================================================================================================
+	Benchmarks
+========================================================================================================
+*/
+
+// Emits the mute signals in bursts, the model thread drains after each of them
+template<typename Q>
+static size_t
+emitSignals(BenchTrigger<Q>& trigger, void (*call)(void*, BenchCalldata*), void* data, const char* name) {
+	int source = 0;
+	BenchCalldata calldata = BenchCalldata{ &source, true };
+
+	size_t before = countedAllocations();
+	Stopwatch watch;
+	for(size_t i = 0; i < MUTE_BENCH_SIGNALS; i++) {
+		call(data, &calldata);
+		if((i + 1) % MUTE_BENCH_BURST == 0)
+			trigger.drain();
+	}
+	trigger.drain();
+	watch.report(name, MUTE_BENCH_SIGNALS);
+
+	size_t allocations = countedAllocations() - before;
+	printf("%-48s %10zu allocations, %.3f per signal\n", name, allocations,
+		static_cast<double>(allocations) / MUTE_BENCH_SIGNALS);
+
+	test_assert(trigger.m_delivered == MUTE_BENCH_SIGNALS);
+	return allocations;
+}
+
+static void
+benchMute() {
+	DequeQueue deque;
+	BenchTrigger<DequeQueue> function_trigger(deque);
+	emitSignals(function_trigger, BenchTrigger<DequeQueue>::CallFunction, &function_trigger.m_function, "100k mute, function copy + deque");
+
+	BenchTrigger<DequeQueue> entry_deque_trigger(deque);
+	emitSignals(entry_deque_trigger, BenchTrigger<DequeQueue>::CallEntry, &entry_deque_trigger.m_entry, "100k mute, registry + deque");
+
+	MPSCQueue<BenchRecord> ring(1024);
+	BenchTrigger<MPSCQueue<BenchRecord>> entry_ring_trigger(ring);
+	size_t allocations = emitSignals(entry_ring_trigger, BenchTrigger<MPSCQueue<BenchRecord>>::CallEntry, &entry_ring_trigger.m_entry, "100k mute, registry + ring");
+
+	test_assert(allocations == 0 && ring.spilled() == 0);
+}
+
+/*
+========================================================================================================
+	Entry Point
+========================================================================================================
+*/
+
+int
+main() {
+	benchMute();
+	return EXIT_SUCCESS;
+}
\ No newline at end of file
@@ -0,0 +1,132 @@
+/*
+ * Std Includes
+ */
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+/*
+ * Plugin Includes
+ */
+#include "include/obs/OBSStorage.hpp"
+#include "Test.hpp"
+
+/*
+========================================================================================================
+	Defines
+========================================================================================================
+*/
+
+#define STORAGE_BENCH_LOOKUPS 1000000
+
+/*
+========================================================================================================
+	Fixtures
+========================================================================================================
+*/
+
+class BenchStorable : public OBSStorable {
+
+	public:
+
+		BenchStorable(uint16_t identifier, const std::string& name) :
+			OBSStorable(identifier, Name(name)) {
+		}
+
+};
+
+static std::string
+storableName(size_t index) {
+	return "Media Source " + std::to_string(index);
+}
+
+/*
+========================================================================================================
+	Tests
+========================================================================================================
+*/
+
+static void
+testStorage() {
+	OBSStorage<BenchStorable> storage;
+
+	// Iteration follows the identifiers, whatever the order of the pushes
+	uint16_t identifiers[] = { 5, 1, 9, 3, 7 };
+	for(uint16_t identifier : identifiers)
+		storage.push(new BenchStorable(identifier, storableName(identifier)));
+	test_assert(storage.size() == 5);
+
+	uint16_t previous = 0;
+	for(auto iter = storage.begin(); iter != storage.end(); iter++) {
+		test_assert(iter->first > previous);
+		test_assert(iter->second->id() == iter->first);
+		previous = iter->first;
+	}
+
+	// Names are looked up from views, identifiers keep their storable
+	std::string name = storableName(7);
+	test_assert(storage[std::string_view(name)] == storage[(uint16_t)7]);
+	test_assert(storage.locate("Media Source 3")->first == 3);
+	test_assert(storage.locate("Media Source 4") == storage.end());
+	std::shared_ptr<BenchStorable> kept = storage.push(new BenchStorable(3, "Other"));
+	test_assert(kept->name() == storableName(3));
+
+	test_assert(storage.move(storableName(9), "Renamed") != nullptr);
+	test_assert(storage["Renamed"] != nullptr && storage[std::string_view(storableName(9))] == nullptr);
+
+	std::shared_ptr<BenchStorable> popped = storage.pop(std::string_view("Renamed"));
+	test_assert(popped != nullptr && popped->id() == 9);
+	test_assert(storage.pop((uint16_t)1) != nullptr);
+	test_assert(storage.size() == 3);
+	test_assert(storage["Media Source 5"]->id() == 5 && storage["Media Source 7"]->id() == 7);
+}
+
+/*
+========================================================================================================
+	Benchmarks
+========================================================================================================
+*/
+
+static void
+benchLookups(size_t count) {
+	OBSStorage<BenchStorable> storage;
+	std::map<std::string, std::shared_ptr<BenchStorable>> baseline;
+	std::vector<std::string> names;
+	for(size_t i = 0; i < count; i++) {
+		names.push_back(storableName(i));
+		std::shared_ptr<BenchStorable> storable = storage.push(new BenchStorable((uint16_t)(i + 1), names.back()));
+		baseline[names.back()] = storable;
+	}
+
+	// Lookups come from C strings handed by OBS, the map needs a std::string for each
+	size_t found = 0;
+	Stopwatch watch;
+	for(size_t i = 0; i < STORAGE_BENCH_LOOKUPS; i++)
+		found += baseline.find(std::string(names[(i * 7919) % count].c_str())) != baseline.end();
+	std::string name = "std::map lookup, " + std::to_string(count) + " entries";
+	watch.report(name.c_str(), STORAGE_BENCH_LOOKUPS);
+
+	watch.restart();
+	for(size_t i = 0; i < STORAGE_BENCH_LOOKUPS; i++)
+		found -= storage[std::string_view(names[(i * 7919) % count].c_str())] != nullptr;
+	name = "OBSStorage lookup, " + std::to_string(count) + " entries";
+	watch.report(name.c_str(), STORAGE_BENCH_LOOKUPS);
+
+	test_assert(found == 0);
+}
+
+/*
+========================================================================================================
+	Entry Point
+========================================================================================================
+*/
+
+int
+main() {
+	testStorage();
+	benchLookups(100);
+	benchLookups(1000);
+	benchLookups(10000);
+	return EXIT_SUCCESS;
+}
\ No newline at end of file
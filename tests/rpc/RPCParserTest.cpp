@@ -0,0 +1,160 @@
+/*
+ * Std Includes
+ */
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+/*
+ * Qt Includes
+ */
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonValue>
+
+/*
+ * Plugin Includes
+ */
+#include "include/rpc/RPCParser.hpp"
+#include "Test.hpp"
+
+/*
+========================================================================================================
+	Defines
+========================================================================================================
+*/
+
+#define RPC_BENCH_MESSAGES 10000
+
+/*
+========================================================================================================
+	Fixtures
+========================================================================================================
+*/
+
+static const char* _get_scenes =
+	"{\"id\":9,\"jsonrpc\":\"2.0\",\"method\":\"getScenes\","
+	"\"params\":{\"resource\":\"ScenesService\",\"args\":[]}}";
+
+static const char* _show_item =
+	"{\"id\":16,\"jsonrpc\":\"2.0\",\"method\":\"showItem\","
+	"\"params\":{\"resource\":\"ItemsService\",\"sceneId\":\"262145\",\"sceneItemId\":\"7\"}}";
+
+/*
+========================================================================================================
+	Tests
+========================================================================================================
+*/
+
+static void
+testParse() {
+	rpc::message message;
+	test_assert(rpc::parser::parse(_get_scenes, strlen(_get_scenes), message));
+	test_assert(message.event == rpc::event::GET_SCENES);
+	test_assert(message.service == "ScenesService");
+	test_assert(message.method == "getScenes");
+	test_assert(message.args.isEmpty());
+
+	// Scene ids carry the collection in their high bits
+	test_assert(rpc::parser::parse(_show_item, strlen(_show_item), message));
+	test_assert(message.event == rpc::event::SHOW_ITEM);
+	test_assert(message.args.size() == 2);
+	QList<QVariant> scene = message.args[0].toList();
+	test_assert(scene.size() == 2 && scene[0].toUInt() == 1 && scene[1].toUInt() == 1);
+	test_assert(message.args[1].toUInt() == 7);
+
+	const char* broken = "{\"id\":9,\"method\":";
+	test_assert(!rpc::parser::parse(broken, strlen(broken), message));
+	test_assert(message.event == rpc::event::ERROR);
+	test_assert(message.frame == QByteArray(broken));
+}
+
+static void
+testFraming() {
+	// Frames are split at arbitrary points across reads, and the ring wraps around
+	rpc::frame_buffer buffer(64);
+	std::string stream;
+	for(int i = 0; i < 8; i++)
+		stream.append(_show_item).append("\n");
+
+	size_t fed = 0;
+	int frames = 0;
+	while(fed < stream.size()) {
+		size_t length = 0;
+		char* data = buffer.reserve(length);
+		size_t chunk = std::min<size_t>({ length, 13, stream.size() - fed });
+		memcpy(data, stream.data() + fed, chunk);
+		buffer.commit(chunk);
+		fed += chunk;
+
+		const char* frame = nullptr;
+		while(buffer.next(frame, length)) {
+			test_assert(length == strlen(_show_item));
+			test_assert(memcmp(frame, _show_item, length) == 0);
+			frames++;
+		}
+	}
+	test_assert(frames == 8);
+	test_assert(buffer.size() == 0);
+}
+
+/*
+========================================================================================================
+	Benchmarks
+========================================================================================================
+*/
+
+static void
+benchParse() {
+	std::string stream;
+	for(int i = 0; i < RPC_BENCH_MESSAGES; i++)
+		stream.append(i % 2 == 0 ? _get_scenes : _show_item).append("\n");
+
+	// Baseline: one DOM per message, then the lookups the former Streamdeck::read did
+	Stopwatch watch;
+	size_t checksum = 0;
+	for(size_t begin = 0, end = 0; (end = stream.find('\n', begin)) != std::string::npos; begin = end + 1) {
+		QJsonDocument document = QJsonDocument::fromJson(QByteArray(stream.data() + begin, (int)(end - begin)));
+		QJsonObject object = document.object();
+		QJsonObject params = object["params"].toObject();
+		checksum += object["id"].toInt() + object["method"].toString().size()
+			+ params["resource"].toString().size() + params["sceneId"].toString().toULongLong()
+			+ params["sceneItemId"].toString().toUInt();
+	}
+	watch.report("rpc QJsonDocument", RPC_BENCH_MESSAGES);
+
+	watch.restart();
+	rpc::frame_buffer buffer;
+	rpc::message message;
+	size_t parsed = 0;
+	for(size_t fed = 0; fed < stream.size();) {
+		size_t length = 0;
+		char* data = buffer.reserve(length);
+		size_t chunk = std::min<size_t>(length, stream.size() - fed);
+		memcpy(data, stream.data() + fed, chunk);
+		buffer.commit(chunk);
+		fed += chunk;
+
+		const char* frame = nullptr;
+		while(buffer.next(frame, length))
+			parsed += rpc::parser::parse(frame, length, message) ? 1 : 0;
+	}
+	watch.report("rpc frame_buffer + parser", RPC_BENCH_MESSAGES);
+
+	test_assert(parsed == RPC_BENCH_MESSAGES);
+	test_assert(checksum > 0);
+}
+
+/*
+========================================================================================================
+	Entry Point
+========================================================================================================
+*/
+
+int
+main() {
+	testParse();
+	testFraming();
+	benchParse();
+	return EXIT_SUCCESS;
+}
\ No newline at end of file
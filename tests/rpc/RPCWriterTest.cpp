@@ -0,0 +1,207 @@
+/*
+ * Std Includes
+ */
+#include <string>
+
+/*
+ * Qt Includes
+ */
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+/*
+ * Plugin Includes
+ */
+#include "include/rpc/RPCWriter.hpp"
+#include "Test.hpp"
+
+/*
+========================================================================================================
+	Defines
+========================================================================================================
+*/
+
+#define WRITER_BENCH_SCENES 500
+
+#define WRITER_BENCH_ITEMS 50
+
+#define WRITER_BENCH_ROUNDS 10
+
+#define WRITER_BENCH_CLIENTS 8
+
+/*
+========================================================================================================
+	Fixtures
+========================================================================================================
+*/
+
+// GET_SCENES shaped response, built the way the former Streamdeck::sendScenes did
+static QJsonDocument
+buildDocument(int scenes, int items, const QString& resource) {
+	QJsonArray scenes_array;
+	for(int i = 0; i < scenes; i++) {
+		QJsonArray items_array;
+		for(int j = 0; j < items; j++) {
+			QJsonObject item;
+			item["id"] = QString::number(j + 1);
+			item["name"] = QString("Item \"%1\"\t%2").arg(i).arg(j);
+			item["sourceId"] = QString::number((1 << 18) | (j + 1));
+			item["visible"] = (j % 3) != 0;
+			items_array.append(item);
+		}
+		QJsonObject scene;
+		scene["id"] = QString::number((1 << 18) | (i + 1));
+		scene["items"] = items_array;
+		scene["name"] = QString("Scene %1 é").arg(i);
+		scenes_array.append(scene);
+	}
+
+	QJsonObject root;
+	root["collection"] = QString("1");
+	root["id"] = 9;
+	root["jsonrpc"] = QString("2.0");
+	root["resourceId"] = resource;
+	root["result"] = scenes_array;
+	return QJsonDocument(root);
+}
+
+// Same response streamed, keys in the order QJsonObject sorts them. Returns where the content of
+// resourceId starts
+template<typename Buffer>
+static int
+writeResponse(Buffer& output, int scenes, int items, const std::string& resource) {
+	rpc::json_writer<Buffer> writer(output);
+	writer.beginObject();
+	writer.key("collection").quoted(1);
+	writer.key("id").value(9);
+	writer.key("jsonrpc").value("2.0");
+	writer.key("resourceId");
+	int splice = (int)output.size() + 1;
+	writer.value(resource);
+	writer.key("result").beginArray();
+	for(int i = 0; i < scenes; i++) {
+		writer.beginObject();
+		writer.key("id").quoted((1 << 18) | (i + 1));
+		writer.key("items").beginArray();
+		for(int j = 0; j < items; j++) {
+			writer.beginObject();
+			writer.key("id").value(std::to_string(j + 1));
+			writer.key("name").value("Item \"" + std::to_string(i) + "\"\t" + std::to_string(j));
+			writer.key("sourceId").quoted((1 << 18) | (j + 1));
+			writer.key("visible").value((j % 3) != 0);
+			writer.endObject();
+		}
+		writer.endArray();
+		writer.key("name").value("Scene " + std::to_string(i) + " \xc3\xa9");
+		writer.endObject();
+	}
+	writer.endArray();
+	writer.endObject();
+	return splice;
+}
+
+/*
+========================================================================================================
+	Tests
+========================================================================================================
+*/
+
+static void
+testWireOutput() {
+	QByteArray expected = buildDocument(3, 4, "ScenesService").toJson(QJsonDocument::Compact);
+
+	QByteArray output;
+	writeResponse(output, 3, 4, "ScenesService");
+	test_assert(output == expected);
+
+	std::string string_output;
+	writeResponse(string_output, 3, 4, "ScenesService");
+	test_assert(QByteArray::fromStdString(string_output) == expected);
+
+	// Control characters are escaped the way Qt does
+	QJsonObject object;
+	object["a"] = QString("\x01\x1f\b\f\n\r\t\\\"/");
+	QByteArray control;
+	rpc::json_writer<QByteArray>(control).beginObject().key("a").value("\x01\x1f\b\f\n\r\t\\\"/").endObject();
+	test_assert(control == QJsonDocument(object).toJson(QJsonDocument::Compact));
+}
+
+static void
+testSplice() {
+	// A body rendered without resource is completed per client, escaping included
+	QByteArray body;
+	int splice = writeResponse(body, 3, 4, "");
+	rpc::frame frame(body, splice);
+	test_assert(frame.render("Deck \"7\"") == buildDocument(3, 4, "Deck \"7\"").toJson(QJsonDocument::Compact));
+	test_assert(frame.render("") == body);
+}
+
+/*
+========================================================================================================
+	Benchmarks
+========================================================================================================
+*/
+
+static void
+benchScenes() {
+	size_t bytes = 0;
+	Stopwatch watch;
+	for(int i = 0; i < WRITER_BENCH_ROUNDS; i++) {
+		QByteArray data = buildDocument(WRITER_BENCH_SCENES, WRITER_BENCH_ITEMS, "ScenesService")
+			.toJson(QJsonDocument::Compact).append("\n");
+		bytes += data.size();
+	}
+	watch.report("scenes 500x50 QJsonDocument", WRITER_BENCH_ROUNDS);
+
+	// The output buffer is reused, as Streamdeck does across responses
+	QByteArray output;
+	watch.restart();
+	for(int i = 0; i < WRITER_BENCH_ROUNDS; i++) {
+		output.clear();
+		writeResponse(output, WRITER_BENCH_SCENES, WRITER_BENCH_ITEMS, "ScenesService");
+		output.push_back('\n');
+		bytes -= output.size();
+	}
+	watch.report("scenes 500x50 json_writer", WRITER_BENCH_ROUNDS);
+
+	test_assert(bytes == 0);
+}
+
+static void
+benchBroadcast() {
+	// Former commit_all: the payload was rebuilt and serialized for each client
+	size_t bytes = 0;
+	Stopwatch watch;
+	for(int i = 0; i < WRITER_BENCH_CLIENTS; i++) {
+		QByteArray data = buildDocument(WRITER_BENCH_SCENES, WRITER_BENCH_ITEMS,
+			QString("Deck %1").arg(i)).toJson(QJsonDocument::Compact);
+		bytes += data.size();
+	}
+	watch.report("broadcast 8 clients QJsonDocument", WRITER_BENCH_CLIENTS);
+
+	watch.restart();
+	QByteArray body;
+	int splice = writeResponse(body, WRITER_BENCH_SCENES, WRITER_BENCH_ITEMS, "");
+	rpc::frame frame(body, splice);
+	for(int i = 0; i < WRITER_BENCH_CLIENTS; i++)
+		bytes -= frame.render("Deck " + std::to_string(i)).size();
+	watch.report("broadcast 8 clients rendered once", WRITER_BENCH_CLIENTS);
+
+	test_assert(bytes == 0);
+}
+
+/*
+========================================================================================================
+	Entry Point
+========================================================================================================
+*/
+
+int
+main() {
+	testWireOutput();
+	testSplice();
+	benchScenes();
+	benchBroadcast();
+	return EXIT_SUCCESS;
+}
\ No newline at end of file